@@ -0,0 +1,308 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace adaptive_merge_sort {
+
+    const size_t MIN_GALLOP = 7; // wins in a row after which the merge switches to galloping
+
+    /**
+     * Worst case time complexity - O(log(k)), where k - the result
+     *
+     * @brief countNotGreaterFromLeft returns the number of leading elements of sorted [first, first + n) that are
+     *        not greater than the key, the range is probed at 1, 2, 4, ... before the binary search
+     */
+    template <typename T>
+    size_t countNotGreaterFromLeft(const T* first, size_t n, const T& key) {
+        size_t low = 0, high = 1;
+
+        while (high <= n && !(key < first[high - 1])) {
+            low   = high;
+            high *= 2;
+        }
+
+        return std::upper_bound(first + low, first + std::min(high, n), key) - first;
+    }
+
+    /**
+     * Worst case time complexity - O(log(k)), where k - the result
+     *
+     * @brief countLessFromLeft returns the number of leading elements of sorted [first, first + n) that are less than the key
+     */
+    template <typename T>
+    size_t countLessFromLeft(const T* first, size_t n, const T& key) {
+        size_t low = 0, high = 1;
+
+        while (high <= n && first[high - 1] < key) {
+            low   = high;
+            high *= 2;
+        }
+
+        return std::lower_bound(first + low, first + std::min(high, n), key) - first;
+    }
+
+    /**
+     * Worst case time complexity - O(log(k)), where k - the result
+     *
+     * @brief countGreaterFromRight returns the number of trailing elements of sorted [first, first + n) that are
+     *        greater than the key
+     */
+    template <typename T>
+    size_t countGreaterFromRight(const T* first, size_t n, const T& key) {
+        size_t low = 0, high = 1;
+
+        while (high <= n && key < first[n - high]) {
+            low   = high;
+            high *= 2;
+        }
+
+        return first + n - std::upper_bound(first + n - std::min(high, n), first + n - low, key);
+    }
+
+    /**
+     * Worst case time complexity - O(log(k)), where k - the result
+     *
+     * @brief countNotLessFromRight returns the number of trailing elements of sorted [first, first + n) that are
+     *        not less than the key
+     */
+    template <typename T>
+    size_t countNotLessFromRight(const T* first, size_t n, const T& key) {
+        size_t low = 0, high = 1;
+
+        while (high <= n && !(first[n - high] < key)) {
+            low   = high;
+            high *= 2;
+        }
+
+        return first + n - std::lower_bound(first + n - std::min(high, n), first + n - low, key);
+    }
+
+    /**
+     * Worst case time complexity - O(n1 + n2)
+     *
+     * @brief mergeLow merges runs [left, left + n1) and [left + n1, left + n1 + n2) moving the first (shorter) one
+     *        into the buffer and filling the vector from the left
+     */
+    template <typename T>
+    void mergeLow(T* left, size_t n1, size_t n2, T* buffer) {
+        std::move(left, left + n1, buffer);
+
+        T* a    = buffer;
+        T* aEnd = buffer + n1;
+        T* b    = left + n1;
+        T* bEnd = b + n2;
+        T* dest = left;
+
+        while (a != aEnd && b != bEnd) {
+            size_t aWins = 0, bWins = 0;
+
+            // one element at a time while neither run wins often
+            while (a != aEnd && b != bEnd && aWins < MIN_GALLOP && bWins < MIN_GALLOP) {
+                if (*b < *a) {
+                    *dest++ = std::move(*b++);
+                    bWins++;
+                    aWins = 0;
+                } else {
+                    *dest++ = std::move(*a++);
+                    aWins++;
+                    bWins = 0;
+                }
+            }
+
+            // galloping: whole blocks are moved while they stay long
+            while (a != aEnd && b != bEnd) {
+                size_t count = countNotGreaterFromLeft(a, aEnd - a, *b);
+
+                dest = std::move(a, a + count, dest);
+                a   += count;
+
+                if (a == aEnd)
+                    break;
+
+                size_t countB = countLessFromLeft((const T*)b, bEnd - b, *a);
+
+                dest = std::move(b, b + countB, dest);
+                b   += countB;
+
+                if (count < MIN_GALLOP && countB < MIN_GALLOP)
+                    break;
+            }
+        }
+
+        std::move(a, aEnd, dest); // the rest of the second run is already in place
+    }
+
+    /**
+     * Worst case time complexity - O(n1 + n2)
+     *
+     * @brief mergeHigh merges runs [left, left + n1) and [left + n1, left + n1 + n2) moving the second (shorter) one
+     *        into the buffer and filling the vector from the right
+     */
+    template <typename T>
+    void mergeHigh(T* left, size_t n1, size_t n2, T* buffer) {
+        std::move(left + n1, left + n1 + n2, buffer);
+
+        T* aBegin = left;
+        T* a      = left + n1;   // end of the unmerged part of the first run
+        T* b      = buffer + n2; // end of the unmerged part of the second run
+        T* dest   = left + n1 + n2;
+
+        while (a != aBegin && b != buffer) {
+            size_t aWins = 0, bWins = 0;
+
+            // equal elements of the second run go last, so the merge stays stable
+            while (a != aBegin && b != buffer && aWins < MIN_GALLOP && bWins < MIN_GALLOP) {
+                if (*(b - 1) < *(a - 1)) {
+                    *--dest = std::move(*--a);
+                    aWins++;
+                    bWins = 0;
+                } else {
+                    *--dest = std::move(*--b);
+                    bWins++;
+                    aWins = 0;
+                }
+            }
+
+            while (a != aBegin && b != buffer) {
+                size_t count = countGreaterFromRight((const T*)aBegin, a - aBegin, *(b - 1));
+
+                dest = std::move_backward(a - count, a, dest);
+                a   -= count;
+
+                if (a == aBegin)
+                    break;
+
+                size_t countB = countNotLessFromRight((const T*)buffer, b - buffer, *(a - 1));
+
+                dest = std::move_backward(b - countB, b, dest);
+                b   -= countB;
+
+                if (count < MIN_GALLOP && countB < MIN_GALLOP)
+                    break;
+            }
+        }
+
+        std::move_backward(buffer, b, dest); // the rest of the first run is already in place
+    }
+
+    /**
+     * Worst case time complexity - O(n1 + n2)
+     *
+     * @brief mergeRuns merges neighbouring sorted runs [left, mid) and [mid, right): elements already in their
+     *        places at both ends are skipped by galloping, then the shorter of the rest goes through the buffer
+     */
+    template <typename T>
+    void mergeRuns(T* data, size_t left, size_t mid, size_t right, T* buffer) {
+        // elements of the first run not greater than the first element of the second one stay in place
+        left += countNotGreaterFromLeft((const T*)data + left, mid - left, data[mid]);
+
+        if (left == mid)
+            return;
+
+        // elements of the second run not less than the last element of the first one stay in place
+        right -= countNotLessFromRight((const T*)data + mid, right - mid, data[mid - 1]);
+
+        if (mid - left <= right - mid)
+            mergeLow(data + left, mid - left, right - mid, buffer);
+        else
+            mergeHigh(data + left, mid - left, right - mid, buffer);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief minimumRun returns the length short runs are extended to, between 16 and 32,
+     *        chosen so that the number of runs is a power of two or slightly less
+     */
+    inline size_t minimumRun(size_t n) {
+        size_t rest = 0;
+
+        while (n >= 32) {
+            rest |= n & 1;
+            n   >>= 1;
+        }
+
+        return n + rest;
+    }
+
+}
+
+/**
+ * Worst time complexity - O(n * log(n)), O(n) on sorted, reversed and nearly sorted data, where n - size of a vector
+ *
+ * @brief adaptiveMergeSort - stable natural merge sort of a vector: ascending and strictly descending runs
+ *        are detected, short runs are extended by binary insertion sort, runs are merged by galloping merges
+ *        through one buffer of n / 2 elements allocated once, elements are moved and never copied
+ * @param vector - vector to sort
+ */
+template <typename T>
+void adaptiveMergeSort(std::vector<T>& vector) {
+    using namespace adaptive_merge_sort;
+
+    size_t n    = vector.size();
+    T*     data = vector.data();
+
+    if (n < 2)
+        return;
+
+    size_t minRun = minimumRun(n);
+
+    std::vector<T> buffer;
+    std::vector<std::pair<size_t, size_t>> runs; // (beginning, length) of the runs waiting to be merged
+
+    auto mergeAt = [&](size_t i) {
+        if (buffer.empty())
+            buffer.resize(n / 2);
+
+        mergeRuns(data, runs[i].first, runs[i + 1].first, runs[i + 1].first + runs[i + 1].second, buffer.data());
+
+        runs[i].second += runs[i + 1].second;
+        runs.erase(runs.begin() + i + 1);
+    };
+
+    for (size_t begin = 0; begin < n; ) {
+        size_t end = begin + 1;
+
+        if (end < n && data[end] < data[end - 1]) {
+            while (end < n && data[end] < data[end - 1])
+                end++;
+
+            std::reverse(data + begin, data + end); // the run is strictly descending, so reversing keeps it stable
+        } else {
+            while (end < n && !(data[end] < data[end - 1]))
+                end++;
+        }
+
+        // binary insertion sort extends a short run
+        size_t forcedEnd = std::min(n, begin + minRun);
+
+        for (; end < forcedEnd; end++) {
+            T* position = std::upper_bound(data + begin, data + end, data[end]);
+            T  element  = std::move(data[end]);
+
+            std::move_backward(position, data + end, data + end + 1);
+            *position = std::move(element);
+        }
+
+        runs.push_back({ begin, end - begin });
+        begin = end;
+
+        // lengths of the runs on the stack grow at least as fast as Fibonacci numbers, so it stays logarithmic
+        while (runs.size() > 1) {
+            size_t k = runs.size();
+
+            if ((k >= 3 && runs[k - 3].second <= runs[k - 2].second + runs[k - 1].second) ||
+                (k >= 4 && runs[k - 4].second <= runs[k - 3].second + runs[k - 2].second))
+                mergeAt(runs[k - 3].second < runs[k - 1].second ? k - 3 : k - 2);
+            else if (runs[k - 2].second <= runs[k - 1].second)
+                mergeAt(k - 2);
+            else
+                break;
+        }
+    }
+
+    while (runs.size() > 1)
+        mergeAt(runs.size() - 2);
+}
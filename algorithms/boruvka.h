@@ -0,0 +1,172 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <climits>
+#include <thread>
+#include <algorithm>
+
+#include "algorithms/disjoint_sets.h"
+#include "algorithms/parallel_for.h"
+
+/**
+ * @brief The WeightedEdge struct is an edge between two vertex indexes used by the Borůvka engine
+ */
+template <typename E>
+struct WeightedEdge {
+    int from;
+    int to;
+    E   weight;
+};
+
+/**
+ * Worst case time complexity - O(E*log(E) / threads + E) with "threads" cores
+ *
+ * @brief sortEdgesByWeight sorts the edges by weight: every thread sorts its own range,
+ *        then neighbouring ranges are merged pairwise in parallel
+ * @param edges - edges to sort
+ * @param threads - number of threads, 0 means std::thread::hardware_concurrency()
+ */
+template <typename E>
+void sortEdgesByWeight(std::vector<WeightedEdge<E>>& edges, unsigned threads) {
+    auto lighter = [](const WeightedEdge<E>& a, const WeightedEdge<E>& b) { return a.weight < b.weight; };
+
+    std::vector<size_t> bounds;
+
+    unsigned ranges = parallelFor(edges.size(), threads, [&](size_t begin, size_t end, unsigned) {
+        std::sort(edges.begin() + begin, edges.begin() + end, lighter);
+    });
+
+    for (unsigned i = 0; i <= ranges; i++)
+        bounds.push_back(edges.size() * i / ranges);
+
+    while (bounds.size() > 2) {
+        size_t merges = (bounds.size() - 1) / 2;
+
+        parallelFor(merges, threads, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i != end; i++)
+                std::inplace_merge(edges.begin() + bounds[2 * i], edges.begin() + bounds[2 * i + 1],
+                                   edges.begin() + bounds[2 * i + 2], lighter);
+        });
+
+        std::vector<size_t> merged;
+        for (size_t i = 0; i < bounds.size(); i += 2)
+            merged.push_back(bounds[i]);
+        if (merged.back() != bounds.back())
+            merged.push_back(bounds.back());
+
+        bounds.swap(merged);
+    }
+}
+
+/**
+ * Worst case time complexity - O((E*log(E) + (V + E)*log(V)) / threads) with "threads" cores
+ *
+ * @brief ParallelBoruvkaOnIndexes runs Borůvka algorithm on several threads and puts in the array "forest"
+ *        the minimum spanning forest of any graph that provides indexCount, indexExist, vertexAt and forEachNeighbor
+ *
+ * Edges are sorted once, so the position of an edge is its rank: a strict order consistent with weights
+ * that breaks ties between equal weights. Every round each thread scans its own part of the live edges and
+ * keeps for every component the edge of the smallest rank leaving it (atomic minimum), edges inside
+ * one component are dropped from the part. Then the chosen edges unite their components in ConcurrentDisjointSets,
+ * an edge chosen by both of its components is added once. There are at most log(V) rounds.
+ * The forest is returned in order of nondecreasing weights.
+ *
+ * @param graph - given graph
+ * @param forest - resulting array
+ * @param threads - number of threads, 0 means std::thread::hardware_concurrency()
+ */
+template <template <typename, typename> class G, typename V, typename E>
+void ParallelBoruvkaOnIndexes(const G<V, E>& graph, std::vector<std::pair<V, V>>& forest, unsigned threads = 0) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    int n = graph.indexCount();
+
+    // collecting the edges, every thread takes its own range of vertices
+    std::vector<std::vector<WeightedEdge<E>>> parts(threads);
+
+    unsigned ranges = parallelFor((size_t)n, threads, [&](size_t begin, size_t end, unsigned thread) {
+        for (int i = (int)begin; i != (int)end; i++) {
+            if (!graph.indexExist(i))
+                continue;
+
+            graph.forEachNeighbor(i, [&](int to, const auto& weight) {
+                if (to != i)
+                    parts[thread].push_back({ i, to, weight });
+            });
+        }
+    });
+
+    std::vector<WeightedEdge<E>> edges;
+    for (unsigned i = 0; i < ranges; i++) {
+        edges.insert(edges.end(), parts[i].begin(), parts[i].end());
+        std::vector<WeightedEdge<E>>().swap(parts[i]);
+    }
+
+    sortEdgesByWeight(edges, threads);
+
+    ConcurrentDisjointSets sets(n);
+
+    std::unique_ptr<std::atomic<int>[]> best(new std::atomic<int>[n]); // rank of the lightest edge leaving a component
+    std::vector<char> chosen(edges.size(), 0);
+
+    for (int i = 0; i < n; i++)
+        best[i].store(INT_MAX, std::memory_order_relaxed);
+
+    // live edges of every thread, initially each thread owns a contiguous range of ranks
+    std::vector<std::vector<int>> live(threads);
+
+    for (unsigned i = 0; i < threads; i++)
+        for (size_t rank = edges.size() * i / threads; rank != edges.size() * (i + 1) / threads; rank++)
+            live[i].push_back((int)rank);
+
+    auto lowerBest = [&](int component, int rank) {
+        int current = best[component].load(std::memory_order_relaxed);
+
+        while (rank < current && !best[component].compare_exchange_weak(current, rank, std::memory_order_relaxed)) { }
+    };
+
+    std::atomic<bool> merged(true);
+
+    while (merged.load()) {
+        merged.store(false);
+
+        parallelFor(live.size(), threads, [&](size_t begin, size_t end, unsigned) {
+            for (size_t part = begin; part != end; part++) {
+                size_t kept = 0;
+
+                for (int rank : live[part]) {
+                    int a = sets.find(edges[rank].from);
+                    int b = sets.find(edges[rank].to);
+
+                    if (a == b)
+                        continue;
+
+                    live[part][kept++] = rank;
+
+                    lowerBest(a, rank);
+                    lowerBest(b, rank);
+                }
+
+                live[part].resize(kept);
+            }
+        });
+
+        parallelFor((size_t)n, threads, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i != end; i++) {
+                int rank = best[i].exchange(INT_MAX, std::memory_order_relaxed);
+
+                if (rank != INT_MAX && sets.unite(edges[rank].from, edges[rank].to)) {
+                    chosen[rank] = 1;
+                    merged.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (size_t rank = 0; rank < edges.size(); rank++)
+        if (chosen[rank])
+            forest.push_back({ graph.vertexAt(edges[rank].from), graph.vertexAt(edges[rank].to) });
+}
@@ -1,9 +1,43 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <stdexcept>
+#include <limits>
+#include <array>
 #include <vector>
 #include <algorithm>
 
+namespace date_tables {
+
+    // days from March 1 to the first day of every month of the year starting in March
+    constexpr std::array<int, 12> MONTH_START = { 0, 31, 61, 92, 122, 153, 184, 214, 245, 275, 306, 337 };
+
+    constexpr std::array<unsigned char, 366> monthOfDayTable() {
+        std::array<unsigned char, 366> table = { };
+
+        for (int day = 0, month = 0; day < 366; day++) {
+            while (month < 11 && day >= MONTH_START[month + 1])
+                month++;
+
+            table[day] = (unsigned char)month;
+        }
+
+        return table;
+    }
+
+    // month (0 - March, ..., 11 - February) of every day of the year starting in March
+    constexpr std::array<unsigned char, 366> MONTH_OF_DAY = monthOfDayTable();
+
+    constexpr std::array<int, 12> DAYS_IN_MONTH = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    // the two digits of every number below 100
+    constexpr char DIGIT_PAIRS[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869"
+        "707172737475767778798081828384858687888990919293949596979899";
+
+}
+
 /**
  * @brief The Date class gives an implementstion of date by day, month and year
  *
@@ -21,27 +55,265 @@ private:
      * @param year  - year of the date
      * @return julian day number by date
      */
-    static long long jdn(int day, int month, int year) {
+    static constexpr long long jdn(int day, int month, int year) {
         long long a = (14 - (long long)month) / 12;
         long long y = (long long)year + 4800 - a;
         long long m = (long long)month + 12*a - 3;
 
-        return (long long)day + (long long)((153*m + 2) / 5) + 365*y + (long long)(y / 4) -
-                (long long)(y / 100) + (long long)(y / 400) - 32045;
+        return (long long)day + (long long)((153*m + 2) / 5) + 365*y + floorDiv(y, 4) -
+                floorDiv(y, 100) + floorDiv(y, 400) - 32045;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief floorDiv divides rounding down, so that leap days are counted right before the year -4800 too
+     */
+    static constexpr long long floorDiv(long long dividend, long long divisor) {
+        return (dividend >= 0 ? dividend : dividend - divisor + 1) / divisor;
+    }
+
+    /**
+     * Worst case time complexity - O(n), where n - length of the field
+     *
+     * @brief ParseField reads an integer from the beginning of the field as std::stoi does: leading whitespace,
+     *        an optional sign, then digits up to the first other character
+     * @throws std::invalid_argument if there are no digits, std::out_of_range if the number does not fit into int
+     */
+    static int ParseField(std::string_view field) {
+        size_t i = 0;
+        while (i < field.size() && (field[i] == ' ' || (field[i] >= '\t' && field[i] <= '\r')))
+            i++;
+
+        bool isNegative = false;
+        if (i < field.size() && (field[i] == '+' || field[i] == '-'))
+            isNegative = field[i++] == '-';
+
+        size_t    first = i;
+        long long value = 0;
+
+        for (; i < field.size() && (unsigned)(field[i] - '0') <= 9; i++) {
+            value = value * 10 + (field[i] - '0');
+
+            if (value > (long long)std::numeric_limits<int>::max() + 1)
+                throw std::out_of_range("Date field out of range: " + std::string(field));
+        }
+
+        if (i == first)
+            throw std::invalid_argument("Invalid date field: " + std::string(field));
+
+        if (!isNegative && value > std::numeric_limits<int>::max())
+            throw std::out_of_range("Date field out of range: " + std::string(field));
+
+        return (int)(isNegative ? -value : value);
     }
 
 public:
     long long date; // julian day number
 
     Date() = default;
-    Date(int year, int month, int day) {
-        date = jdn(day, month, year);
-    }
+    constexpr Date(int year, int month, int day) : date(jdn(day, month, year)) { }
 
-    void increaseDay() {
+    constexpr void increaseDay() {
         date++;
     }
 
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief FromJulianDay returns the date with the given julian day number
+     * @param julianDay - julian day number
+     * @return the date
+     */
+    static constexpr Date FromJulianDay(long long julianDay) {
+        Date result{};
+        result.date = julianDay;
+        return result;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief decode returns the year, the month and the day of the date: the day of the era of 400 years
+     *        and the day of the year starting in March are found arithmetically, the month by the table
+     * @param year  - year of the date
+     * @param month - month of the date
+     * @param day   - day of the date
+     */
+    constexpr void decode(int& year, int& month, int& day) const {
+        long long days = date - 1721120; // days since 0000-03-01
+
+        long long era       = (days >= 0 ? days : days - 146096) / 146097;
+        long long dayOfEra  = days - era * 146097;
+        long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+
+        int marchMonth = date_tables::MONTH_OF_DAY[dayOfYear];
+
+        day   = (int)(dayOfYear - date_tables::MONTH_START[marchMonth]) + 1;
+        month = marchMonth < 10 ? marchMonth + 3 : marchMonth - 9;
+        year  = (int)(yearOfEra + era * 400) + (month <= 2 ? 1 : 0);
+    }
+
+    constexpr int year() const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+        return year;
+    }
+
+    constexpr int month() const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+        return month;
+    }
+
+    constexpr int day() const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+        return day;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief dayOfWeek returns the day of the week of the date
+     * @return 0 for Monday, ..., 6 for Sunday
+     */
+    constexpr int dayOfWeek() const {
+        return (int)(date % 7 + 7) % 7; // julian day 0 is Monday
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief startOfWeek returns the Monday of the week of the date
+     */
+    constexpr Date startOfWeek() const {
+        return FromJulianDay(date - dayOfWeek());
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief startOfMonth returns the first day of the month of the date
+     */
+    constexpr Date startOfMonth() const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+        return FromJulianDay(date - day + 1);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief monthBucket returns the number of the month of the date counted from the year 0,
+     *        dates of one month have the same bucket and buckets of consecutive months are consecutive
+     */
+    constexpr long long monthBucket() const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+        return (long long)year * 12 + (month - 1);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief weekBucket returns the number of the week (from Monday to Sunday) of the date,
+     *        dates of one week have the same bucket and buckets of consecutive weeks are consecutive
+     */
+    constexpr long long weekBucket() const {
+        return (date - dayOfWeek()) / 7;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief addDays returns the date the given number of days later
+     */
+    constexpr Date addDays(long long days) const {
+        return FromJulianDay(date + days);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief addMonths returns the date the given number of months later, the day is clamped to the end of the month
+     */
+    constexpr Date addMonths(int months) const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+
+        long long bucket = (long long)year * 12 + (month - 1) + months;
+
+        int newYear  = (int)(bucket >= 0 ? bucket / 12 : (bucket - 11) / 12);
+        int newMonth = (int)(bucket - (long long)newYear * 12) + 1;
+
+        return Date(newYear, newMonth, std::min(day, DaysInMonth(newYear, newMonth)));
+    }
+
+    static const int MIN_FORMATTED_YEAR   = 0;
+    static const int MAX_FORMATTED_YEAR   = 9999;
+    static const int MAX_FORMATTED_LENGTH = 17; // sign, 10 digits of the year and -MM-DD
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief format writes the date in format YYYY-MM-DD without allocations, years outside 0-9999 are written
+     *        with a sign if they are negative and with as many digits as they have, as in ISO 8601 (e.g. -0005-03-01)
+     * @param buffer - at least 10 characters for years 0-9999, at least MAX_FORMATTED_LENGTH characters for any year,
+     *        no terminating zero is written
+     * @return pointer past the written characters
+     */
+    char* format(char* buffer) const {
+        int year = 0, month = 0, day = 0;
+        decode(year, month, day);
+
+        const char* digits = date_tables::DIGIT_PAIRS;
+
+        if (year < MIN_FORMATTED_YEAR || year > MAX_FORMATTED_YEAR) {
+            long long absoluteYear = year < 0 ? -(long long)year : year;
+
+            char yearDigits[10];
+            int  length = 0;
+
+            for (; absoluteYear != 0 || length < 4; absoluteYear /= 10)
+                yearDigits[length++] = (char)('0' + absoluteYear % 10);
+
+            if (year < 0)
+                *buffer++ = '-';
+
+            while (length > 0)
+                *buffer++ = yearDigits[--length];
+        } else {
+            int high = year / 100, low = year % 100;
+
+            buffer[0] = digits[2 * high];
+            buffer[1] = digits[2 * high + 1];
+            buffer[2] = digits[2 * low];
+            buffer[3] = digits[2 * low + 1];
+            buffer   += 4;
+        }
+
+        buffer[0] = '-';
+        buffer[1] = digits[2 * month];
+        buffer[2] = digits[2 * month + 1];
+        buffer[3] = '-';
+        buffer[4] = digits[2 * day];
+        buffer[5] = digits[2 * day + 1];
+
+        return buffer + 6;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief toString returns the date in format YYYY-MM-DD (see format)
+     */
+    std::string toString() const {
+        char buffer[MAX_FORMATTED_LENGTH];
+        return std::string(buffer, format(buffer));
+    }
+
     /**
      * Worst case time complexity - O(1)
      *
@@ -50,7 +322,7 @@ public:
      * @param date2 - second date
      * @return true if date1 is less than date2
      */
-    friend bool operator < (const Date& date1, const Date& date2) {
+    friend constexpr bool operator < (const Date& date1, const Date& date2) {
         return date1.date < date2.date;
     }
 
@@ -62,7 +334,7 @@ public:
      * @param date2 - second date
      * @return true if date1 is equal to date2
      */
-    friend bool operator == (const Date& date1, const Date& date2) {
+    friend constexpr bool operator == (const Date& date1, const Date& date2) {
         return date1.date == date2.date;
     }
 
@@ -74,7 +346,7 @@ public:
      * @param date2 - second date
      * @return true if date1 is less or equal than date2
      */
-    friend bool operator <= (const Date& date1, const Date& date2) {
+    friend constexpr bool operator <= (const Date& date1, const Date& date2) {
         return date1 < date2 || date1 == date2;
     }
 
@@ -86,29 +358,98 @@ public:
      * @param date2 - second date
      * @return true if date1 is greater than date2
      */
-    friend bool operator > (const Date& date1, const Date& date2) {
+    friend constexpr bool operator > (const Date& date1, const Date& date2) {
         return !(date1 <= date2);
     }
 
     /**
      * Worst case time complexity - O(1)
      *
-     * @brief GetDateFromString returns Date from given string date given in format YYYY-MM-DD
+     * @brief IsValid checks that the day exists in the month of the year of the Gregorian calendar
+     * @param year  - year of the date
+     * @param month - month of the date
+     * @param day   - day of the date
+     * @return true if the date exists
+     */
+    static constexpr bool IsValid(int year, int month, int day) {
+        return month >= 1 && month <= 12 && day >= 1 && day <= DaysInMonth(year, month);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief IsLeapYear checks that the year of the Gregorian calendar has February 29
+     */
+    static constexpr bool IsLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief DaysInMonth returns the number of days of the month (from 1 to 12) of the year
+     */
+    static constexpr int DaysInMonth(int year, int month) {
+        return date_tables::DAYS_IN_MONTH[month - 1] + (month == 2 && IsLeapYear(year) ? 1 : 0);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief TryParse parses date given in format YYYY-MM-DD without allocations
+     * @param string_date date in format YYYY-MM-DD
+     * @param date - the result, it is not changed if the string is not a valid date
+     * @return true if the string is a valid date
+     */
+    static bool TryParse(std::string_view string_date, Date& date) {
+        if (string_date.size() != 10 || string_date[4] != '-' || string_date[7] != '-')
+            return false;
+
+        int value[3] = { 0, 0, 0 };
+
+        for (size_t i = 0; i < 10; i++) {
+            if (i == 4 || i == 7)
+                continue;
+
+            unsigned digit = (unsigned)(string_date[i] - '0');
+            if (digit > 9)
+                return false;
+
+            int& part = value[i < 4 ? 0 : i < 7 ? 1 : 2];
+            part = part * 10 + (int)digit;
+        }
+
+        if (!IsValid(value[0], value[1], value[2]))
+            return false;
+
+        date = Date(value[0], value[1], value[2]);
+
+        return true;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief GetDateFromString returns Date from given string date given in format YYYY-MM-DD,
+     *        valid dates go through TryParse, other strings are read leniently as before: the year from the first
+     *        4 characters, the month from the characters 5-6 and the day from the rest, each as std::stoi reads it,
+     *        days out of the month roll over to the next months (TryParse and parseDates are the strict parsers)
      * @param string_date date in format YYYY-MM-DD
      * @return Date from given string date given in format YYYY-MM-DD
+     * @throws std::invalid_argument if the string is shorter than 9 characters or a field has no digits,
+     *         std::out_of_range if the day does not fit into int
      */
-    static Date GetDateFromString(std::string string_date) {
-        std::string year(string_date.cbegin(), string_date.cbegin() + 4);
-        std::string month(string_date.cbegin() + 5, string_date.cbegin() + 7);
-        std::string day(string_date.cbegin() + 8, string_date.cend());
+    static Date GetDateFromString(std::string_view string_date) {
+        Date time;
 
-        int year_int  = stoi(year);
-        int month_int = stoi(month);
-        int day_int   = stoi(day);
+        if (TryParse(string_date, time))
+            return time;
 
-        Date time(year_int, month_int, day_int);
+        if (string_date.size() < 9)
+            throw std::invalid_argument("Invalid date: " + std::string(string_date));
 
-        return time;
+        return Date(ParseField(string_date.substr(0, 4)), ParseField(string_date.substr(5, 2)),
+                    ParseField(string_date.substr(8)));
     }
 };
 
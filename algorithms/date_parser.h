@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <stdexcept>
+
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+
+#include "algorithms/date.h"
+
+/**
+ * Bulk parsing and formatting of fixed-width dates in format YYYY-MM-DD. With SSSE3 (-mssse3, -mavx2 or -march=native)
+ * every parsed row is loaded into one register of 16 bytes: the digits and the dashes are validated by vector comparisons,
+ * the digits are gathered by a shuffle and combined into the year, the month and the day by two multiply-adds. Rows too
+ * close to the end of the buffer for a load of 16 bytes, and all the rows without SSSE3, go through Date::TryParse.
+ */
+namespace date_parser {
+
+    const size_t DATE_WIDTH = 10; // YYYY-MM-DD
+
+#ifdef __SSSE3__
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief parseRow parses the date at the beginning of 16 readable bytes, returns false if it is malformed
+     */
+    inline bool parseRow(const char* row, int& year, int& month, int& day) {
+        const __m128i text   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+        const __m128i digits = _mm_sub_epi8(text, _mm_set1_epi8('0'));
+
+        // a byte is a digit if it does not exceed 9 after the subtraction as an unsigned number
+        const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const __m128i isDash  = _mm_cmpeq_epi8(text, _mm_set1_epi8('-'));
+
+        const int DIGIT_MASK = 0x36F; // bytes 0-3, 5-6 and 8-9
+        const int DASH_MASK  = 0x090; // bytes 4 and 7
+
+        if ((_mm_movemask_epi8(isDigit) & DIGIT_MASK) != DIGIT_MASK || (_mm_movemask_epi8(isDash) & DASH_MASK) != DASH_MASK)
+            return false;
+
+        // 16-bit words: 10*Y0+Y1, 10*Y2+Y3, 10*M0+M1, 0, 10*D0+D1, 0, 0, 0
+        const __m128i packed = _mm_shuffle_epi8(digits, _mm_setr_epi8(0, 1, 2, 3, 5, 6, -1, -1, 8, 9, -1, -1, -1, -1, -1, -1));
+        const __m128i pairs  = _mm_maddubs_epi16(packed, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 0, 0, 10, 1, 0, 0, 0, 0, 0, 0));
+
+        // 32-bit words: year, month, day, 0
+        const __m128i values = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 1, 0, 1, 0, 0, 0));
+
+        year  = _mm_cvtsi128_si32(values);
+        month = _mm_cvtsi128_si32(_mm_srli_si128(values, 4));
+        day   = _mm_cvtsi128_si32(_mm_srli_si128(values, 8));
+
+        return true;
+    }
+#endif
+
+}
+
+/**
+ * Worst time complexity - O(n) (linear), where n - number of rows
+ *
+ * @brief parseDates parses a buffer of fixed-width rows that start with a date in format YYYY-MM-DD into dates,
+ *        nothing is allocated
+ * @param buffer - the rows, the i-th row starts at buffer + i * stride
+ * @param count - number of rows, the buffer has at least (count - 1) * stride + 10 bytes
+ * @param stride - distance between the beginnings of the rows, at least 10 (e.g. 11 for lines ending with '\n')
+ * @param dates - array of count dates for the result, the dates of malformed rows are not changed
+ * @param onMalformed - onMalformed(row) is called for every row that is not a valid date, in ascending order
+ * @return number of malformed rows
+ */
+template <typename F>
+size_t parseDates(const char* buffer, size_t count, size_t stride, Date* dates, F onMalformed) {
+    using namespace date_parser;
+
+    size_t malformed = 0;
+    size_t row       = 0;
+
+#ifdef __SSSE3__
+    if (count > 0) {
+        size_t size = (count - 1) * stride + DATE_WIDTH;
+
+        for (; row < count && row * stride + 16 <= size; row++) {
+            int year, month, day;
+
+            if (parseRow(buffer + row * stride, year, month, day) && Date::IsValid(year, month, day)) {
+                dates[row] = Date(year, month, day);
+            } else {
+                malformed++;
+                onMalformed(row);
+            }
+        }
+    }
+#endif
+
+    for (; row < count; row++) {
+        if (!Date::TryParse(std::string_view(buffer + row * stride, DATE_WIDTH), dates[row])) {
+            malformed++;
+            onMalformed(row);
+        }
+    }
+
+    return malformed;
+}
+
+/**
+ * Worst time complexity - O(n) (linear), where n - number of rows
+ *
+ * @brief parseDates parses a buffer of fixed-width rows that start with a date in format YYYY-MM-DD into dates
+ * @return number of malformed rows, their dates are not changed
+ */
+inline size_t parseDates(const char* buffer, size_t count, size_t stride, Date* dates) {
+    return parseDates(buffer, count, stride, dates, [](size_t) { });
+}
+
+/**
+ * Worst time complexity - O(n) (linear), where n - number of dates
+ *
+ * @brief formatDates writes the dates in format YYYY-MM-DD into fixed-width rows of the buffer, nothing is allocated
+ *        and the bytes of the rows after the dates are not changed
+ * @param dates - array of count dates
+ * @param count - number of dates
+ * @param buffer - the rows, the i-th row starts at buffer + i * stride, it has at least (count - 1) * stride + 10 bytes
+ * @param stride - distance between the beginnings of the rows, at least 10
+ * @throws std::out_of_range if a year is outside 0-9999 and does not fit the row, the rows before it are written
+ */
+inline void formatDates(const Date* dates, size_t count, char* buffer, size_t stride) {
+    const long long first = Date(Date::MIN_FORMATTED_YEAR, 1, 1).date;
+    const long long last  = Date(Date::MAX_FORMATTED_YEAR, 12, 31).date;
+
+    for (size_t row = 0; row < count; row++) {
+        if (dates[row].date < first || dates[row].date > last)
+            throw std::out_of_range("Date does not fit format YYYY-MM-DD: " + dates[row].toString());
+
+        dates[row].format(buffer + row * stride);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief The ConcurrentDisjointSets class implements union-find over indexes 0 .. size - 1
+ *        that may be used by several threads at the same time
+ *
+ * Roots are linked with compare-and-swap, the root with the bigger index is always linked under the one
+ * with the smaller index, so no cycle can appear. find compresses paths by halving, a failed compression
+ * is ignored because some other thread has already moved the pointer up the same tree.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ */
+class ConcurrentDisjointSets {
+private:
+    int size;
+
+    std::unique_ptr<std::atomic<int>[]> parent;
+
+public:
+    explicit ConcurrentDisjointSets(int size) : size(size), parent(new std::atomic<int>[size]) {
+        for (int i = 0; i < size; i++)
+            parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * Amortized time complexity - O(log(size))
+     *
+     * @brief find returns the root of the set of the given index
+     * @param index - given index
+     * @return the root of the set
+     */
+    int find(int index) {
+        while (true) {
+            int up = parent[index].load(std::memory_order_acquire);
+            if (up == index)
+                return index;
+
+            int grand = parent[up].load(std::memory_order_acquire);
+            if (grand == up)
+                return up;
+
+            parent[index].compare_exchange_weak(up, grand, std::memory_order_release, std::memory_order_relaxed);
+            index = grand;
+        }
+    }
+
+    /**
+     * Amortized time complexity - O(log(size))
+     *
+     * @brief unite merges the sets of two indexes
+     * @param a - first index
+     * @param b - second index
+     * @return true if the sets were different, exactly one of the concurrent calls merging the same sets returns true
+     */
+    bool unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+
+            if (a == b)
+                return false;
+
+            if (a < b)
+                std::swap(a, b);
+
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief count returns the number of indexes
+     * @return the number of indexes
+     */
+    int count() const {
+        return size;
+    }
+};
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+
+#include "graph/graph_on_adjacency_matrix.h"
+#include "graph/graph_observer.h"
+#include "graph/flat_hash_map.h"
+#include "algorithms/link_cut_tree.h"
+
+/**
+ * @brief The DynamicMinSpanningForest class keeps the minimum spanning forest of an AdjacencyMatrix
+ *        up to date while edges of the graph are inserted and removed
+ *
+ * Every directed edge is a candidate undirected edge of the forest, like in GetMinSpanningForest.
+ * Tree edges are weighted nodes of a LinkCutTree between the nodes of their vertices, every edge is also kept
+ * in the lists of incident edges of both its ends.
+ *  - insertion: if the ends are in different trees, the edge links them, otherwise it replaces the heaviest
+ *    edge on the tree path between them if it is lighter - amortized O(log(V));
+ *  - removal of a non-tree edge - O(1);
+ *  - removal of a tree edge cuts the tree in two, both parts are searched in turns along tree edges until
+ *    the smaller one is passed, and the lightest non-tree edge leaving it reconnects the tree -
+ *    O(k + log(V)), where k - number of edges incident to the vertices of the smaller part.
+ *
+ * Nodes of removed vertices are freed, so the memory follows the current graph.
+ *
+ * The forest subscribes to the graph in the constructor and unsubscribes in the destructor,
+ * so it must not outlive the graph.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     GraphObserver
+ * @see     LinkCutTree
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class DynamicMinSpanningForest : public GraphObserver<V, E> {
+private:
+    /**
+     * @brief The ForestEdge struct is an edge known to the forest
+     */
+    struct ForestEdge {
+        int  from;         // node of the beginning
+        int  to;           // node of the end
+        E    weight;
+        int  node;         // node of the edge in the link-cut tree, -1 if the edge is not in the forest
+        int  fromPosition; // position of the edge in incident[from]
+        int  toPosition;   // position of the edge in incident[to]
+    };
+
+    AdjacencyMatrix<V, E>& graph;
+
+    LinkCutTree<E> trees;
+
+    FlatHashMap<V, int> nodeOfVertex;
+    std::vector<V>      vertexOfNode; // defined only for nodes of vertices
+
+    FlatHashMap<uint64_t, int> edgeOfPair; // (node of the beginning, node of the end) -> edge
+    std::vector<ForestEdge>    edges;
+    std::vector<int>           freeEdges;
+    std::vector<int>           edgeOfNode; // edge stored in a node of the link-cut tree, defined only for nodes of edges
+
+    std::vector<std::vector<int>> incident; // edges of a node of a vertex, tree and non-tree ones
+
+    // searches of the parts of a cut tree: visited vertices of both parts and stamps that mark them
+    std::vector<int>      searchOrder[2];
+    std::vector<uint32_t> marks;
+    uint32_t              stamp;
+
+    size_t treeEdges;
+
+    static uint64_t pairKey(int from, int to) {
+        return ((uint64_t)(uint32_t)from << 32) | (uint32_t)to;
+    }
+
+    int nodeOf(const V& vertex) {
+        const int* node = nodeOfVertex.find(vertex);
+
+        if (node != nullptr)
+            return *node;
+
+        int newNode = trees.addNode();
+
+        if ((size_t)newNode >= vertexOfNode.size())
+            vertexOfNode.resize(newNode + 1);
+
+        vertexOfNode[newNode] = vertex;
+        nodeOfVertex.insert(vertex, newNode);
+
+        if ((size_t)newNode >= incident.size())
+            incident.resize(newNode + 1);
+
+        return newNode;
+    }
+
+    int& positionIn(int edge, int node) {
+        return edges[edge].from == node ? edges[edge].fromPosition : edges[edge].toPosition;
+    }
+
+    int otherEnd(int edge, int node) const {
+        return edges[edge].from == node ? edges[edge].to : edges[edge].from;
+    }
+
+    void attach(int edge, int node) {
+        positionIn(edge, node) = (int)incident[node].size();
+        incident[node].push_back(edge);
+    }
+
+    void detach(int edge, int node) {
+        std::vector<int>& list     = incident[node];
+        int               position = positionIn(edge, node);
+
+        list[position]                   = list.back();
+        positionIn(list[position], node) = position;
+        list.pop_back();
+    }
+
+    void linkEdge(int edge) {
+        ForestEdge& e = edges[edge];
+
+        e.node = trees.addNode(e.weight);
+
+        if ((size_t)e.node >= edgeOfNode.size())
+            edgeOfNode.resize(e.node + 1, -1);
+        edgeOfNode[e.node] = edge;
+
+        trees.link(e.from, e.node);
+        trees.link(e.node, e.to);
+
+        treeEdges++;
+    }
+
+    void cutEdge(int edge) {
+        ForestEdge& e = edges[edge];
+
+        trees.cut(e.from, e.node);
+        trees.cut(e.node, e.to);
+        trees.removeNode(e.node);
+
+        e.node = -1;
+
+        treeEdges--;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief searchStep checks one incident edge of the search of one part of a cut tree
+     * @param side - 0 or 1, the part
+     * @param vertex - position of the current vertex in searchOrder[side]
+     * @param position - position of the next edge in the list of the current vertex
+     * @return false if the part is searched completely
+     */
+    bool searchStep(int side, size_t& vertex, size_t& position) {
+        std::vector<int>& order = searchOrder[side];
+
+        while (vertex != order.size() && position == incident[order[vertex]].size()) {
+            vertex++;
+            position = 0;
+        }
+
+        if (vertex == order.size())
+            return false;
+
+        int node = order[vertex];
+        int edge = incident[node][position++];
+
+        if (edges[edge].node != -1) {
+            int next = otherEnd(edge, node);
+
+            if (marks[next] != stamp + side) {
+                marks[next] = stamp + side;
+                order.push_back(next);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Worst case time complexity - O(k), where k - number of edges incident to the vertices of the smaller part
+     *
+     * @brief findReplacement searches both parts of a tree cut between two nodes in turns, one edge per step,
+     *        and returns the lightest non-tree edge leaving the part whose search finishes first
+     *        (non-tree edges never connect different trees, so such an edge joins exactly these two parts)
+     * @param fromNode - node on one side of the cut
+     * @param toNode - node on the other side of the cut
+     * @return the replacement edge, -1 if the parts are not connected by any edge
+     */
+    int findReplacement(int fromNode, int toNode) {
+        if (marks.size() < incident.size())
+            marks.resize(incident.size(), 0);
+
+        if (stamp > UINT32_MAX - 4) {
+            std::fill(marks.begin(), marks.end(), 0);
+            stamp = 0;
+        }
+
+        stamp += 2; // vertices of the part of "fromNode" are marked by stamp, the other ones by stamp + 1
+
+        searchOrder[0].assign(1, fromNode);
+        searchOrder[1].assign(1, toNode);
+        marks[fromNode] = stamp;
+        marks[toNode]   = stamp + 1;
+
+        size_t vertex[2]   = { 0, 0 };
+        size_t position[2] = { 0, 0 };
+        int    side        = 0;
+
+        while (searchStep(side, vertex[side], position[side]))
+            side ^= 1;
+
+        int replacement = -1;
+
+        for (int node : searchOrder[side]) {
+            for (int edge : incident[node]) {
+                if (edges[edge].node != -1 || marks[otherEnd(edge, node)] == stamp + side)
+                    continue;
+
+                if (replacement == -1 || edges[edge].weight < edges[replacement].weight ||
+                    (!(edges[replacement].weight < edges[edge].weight) && edge < replacement))
+                    replacement = edge;
+            }
+        }
+
+        return replacement;
+    }
+
+public:
+    /**
+     * Amortized time complexity - O(E*log(V))
+     *
+     * @brief DynamicMinSpanningForest builds the forest of the current edges and subscribes to the graph
+     * @param graph - observed graph
+     */
+    explicit DynamicMinSpanningForest(AdjacencyMatrix<V, E>& graph) : graph(graph), stamp(0), treeEdges(0) {
+        for (int i = 0; i < graph.indexCount(); i++) {
+            if (!graph.indexExist(i))
+                continue;
+
+            graph.forEachNeighbor(i, [&](int to, const E& weight) {
+                edgeInserted(graph.vertexAt(i), graph.vertexAt(to), weight);
+            });
+        }
+
+        graph.addObserver(this);
+    }
+
+    DynamicMinSpanningForest(const DynamicMinSpanningForest&)            = delete;
+    DynamicMinSpanningForest& operator=(const DynamicMinSpanningForest&) = delete;
+
+    ~DynamicMinSpanningForest() override {
+        graph.removeObserver(this);
+    }
+
+    /**
+     * Amortized time complexity - O(log(V) + log(E))
+     *
+     * @brief edgeInserted adds the edge to the forest if it is lighter than the heaviest edge of the cycle it closes,
+     *        an edge with replaced weight is removed and inserted again
+     * @param from - beginning of the edge
+     * @param to - end of the edge
+     * @param weight - weight of the edge
+     */
+    void edgeInserted(const V& from, const V& to, const E& weight) override {
+        int fromNode = nodeOf(from);
+        int toNode   = nodeOf(to);
+
+        if (fromNode == toNode)
+            return; // self loops never belong to the forest
+
+        if (edgeOfPair.count(pairKey(fromNode, toNode)) == 1)
+            edgeRemoved(from, to);
+
+        int edge;
+
+        if (!freeEdges.empty()) {
+            edge = freeEdges.back();
+            freeEdges.pop_back();
+        } else {
+            edge = (int)edges.size();
+            edges.emplace_back();
+        }
+
+        edges[edge] = ForestEdge{ fromNode, toNode, weight, -1, -1, -1 };
+        edgeOfPair.insert(pairKey(fromNode, toNode), edge);
+
+        attach(edge, fromNode);
+        attach(edge, toNode);
+
+        if (!trees.connected(fromNode, toNode)) {
+            linkEdge(edge);
+            return;
+        }
+
+        int heaviestNode = trees.heaviestOnPath(fromNode, toNode);
+
+        if (!(weight < trees.weight(heaviestNode)))
+            return;
+
+        // the new edge replaces the heaviest edge of the cycle
+        cutEdge(edgeOfNode[heaviestNode]);
+        linkEdge(edge);
+    }
+
+    /**
+     * Amortized time complexity - O(1) for a non-tree edge, O(k + log(V)) for a tree edge,
+     * where k - number of edges incident to the vertices of the smaller part of the cut tree
+     *
+     * @brief edgeRemoved removes the edge from the forest and reconnects the tree with the lightest replacement edge
+     * @param from - beginning of the edge
+     * @param to - end of the edge
+     */
+    void edgeRemoved(const V& from, const V& to) override {
+        const int* fromNode = nodeOfVertex.find(from);
+        const int* toNode   = nodeOfVertex.find(to);
+
+        if (fromNode == nullptr || toNode == nullptr)
+            return;
+
+        uint64_t   key  = pairKey(*fromNode, *toNode);
+        const int* slot = edgeOfPair.find(key);
+
+        if (slot == nullptr)
+            return; // self loop or unknown edge
+
+        int edge = *slot;
+
+        edgeOfPair.erase(key);
+        freeEdges.push_back(edge);
+
+        detach(edge, *fromNode);
+        detach(edge, *toNode);
+
+        if (edges[edge].node == -1)
+            return;
+
+        cutEdge(edge);
+
+        int replacement = findReplacement(*fromNode, *toNode);
+
+        if (replacement != -1)
+            linkEdge(replacement);
+    }
+
+    /**
+     * Amortized time complexity - O(log(V)), the graph has removed all the edges of the vertex before
+     *
+     * @brief vertexRemoved frees the node of the vertex
+     * @param vertex - removed vertex
+     */
+    void vertexRemoved(const V& vertex) override {
+        const int* slot = nodeOfVertex.find(vertex);
+
+        if (slot == nullptr)
+            return;
+
+        int node = *slot;
+
+        while (!incident[node].empty()) {
+            const ForestEdge& edge = edges[incident[node].back()];
+            edgeRemoved(vertexOfNode[edge.from], vertexOfNode[edge.to]);
+        }
+
+        nodeOfVertex.erase(vertex);
+        trees.removeNode(node);
+        std::vector<int>().swap(incident[node]);
+    }
+
+    /**
+     * Worst case time complexity - O(E)
+     *
+     * @brief getForest puts in the array "forest" the edges of the current minimum spanning forest
+     * @param forest - resulting array
+     */
+    void getForest(std::vector<std::pair<V, V>>& forest) const {
+        forest.reserve(forest.size() + treeEdges);
+
+        for (const ForestEdge& edge : edges)
+            if (edge.node != -1)
+                forest.push_back({ vertexOfNode[edge.from], vertexOfNode[edge.to] });
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief size returns the number of edges in the forest
+     * @return the number of edges in the forest
+     */
+    size_t size() const {
+        return treeEdges;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief numberOfVertices returns the number of vertices the forest keeps nodes for
+     * @return the number of vertices the forest keeps nodes for
+     */
+    size_t numberOfVertices() const {
+        return nodeOfVertex.size();
+    }
+};
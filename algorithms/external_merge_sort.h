@@ -0,0 +1,478 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include <memory_resource>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "algorithms/merge_sort.h"
+
+/**
+ * @brief The ExternalSortStatistics struct describes the work done by an external sort
+ */
+struct ExternalSortStatistics {
+    uint64_t elements     = 0; // number of sorted elements
+    uint64_t elementBytes = 0; // size of the sorted elements
+    uint64_t runs         = 0; // number of sorted runs written by the first pass
+    uint64_t mergePasses  = 0; // number of passes over the data on disk, the last one streams to the output
+    uint64_t bytesRead    = 0; // bytes read from the run files
+    uint64_t bytesWritten = 0; // bytes written to the run files and the output
+
+    double runSeconds   = 0; // time of sorting and writing the runs
+    double mergeSeconds = 0; // time of all the merge passes
+
+    /**
+     * @brief megabytesPerSecond returns the throughput of the whole sort: sorted megabytes per second
+     */
+    double megabytesPerSecond() const {
+        double seconds = runSeconds + mergeSeconds;
+        return seconds > 0 ? elementBytes / 1e6 / seconds : 0;
+    }
+
+    /**
+     * @brief ioMegabytesPerSecond returns the disk bandwidth achieved: megabytes read and written per second
+     */
+    double ioMegabytesPerSecond() const {
+        double seconds = runSeconds + mergeSeconds;
+        return seconds > 0 ? (bytesRead + bytesWritten) / 1e6 / seconds : 0;
+    }
+};
+
+namespace external_merge_sort {
+
+    /**
+     * @brief The RunFile class is a temporary file of sorted runs (POSIX), it is unlinked as soon as it is created,
+     *        so it disappears when closed even if the process is killed
+     */
+    class RunFile {
+    private:
+        int descriptor;
+
+    public:
+        uint64_t size; // bytes written so far
+
+        explicit RunFile(const std::string& directory) : descriptor(-1), size(0) {
+            std::string path = directory + "/external_sort_XXXXXX";
+
+            descriptor = mkstemp(&path[0]);
+            if (descriptor == -1)
+                throw std::runtime_error("Cannot create a temporary file in " + directory);
+
+            unlink(path.c_str());
+        }
+
+        RunFile(const RunFile&)             = delete;
+        RunFile& operator = (const RunFile&) = delete;
+
+        ~RunFile() {
+            close(descriptor);
+        }
+
+        /**
+         * @brief append writes the bytes at the end of the file
+         */
+        void append(const void* data, size_t bytes) {
+            const char* position = static_cast<const char*>(data);
+
+            while (bytes > 0) {
+                ssize_t written = pwrite(descriptor, position, bytes, (off_t)size);
+                if (written <= 0)
+                    throw std::runtime_error("Cannot write a temporary file of the external sort");
+
+                position += written;
+                bytes    -= written;
+                size     += written;
+            }
+        }
+
+        /**
+         * @brief read reads exactly "bytes" bytes from the offset
+         */
+        void read(void* data, size_t bytes, uint64_t offset) const {
+            char* position = static_cast<char*>(data);
+
+            while (bytes > 0) {
+                ssize_t count = pread(descriptor, position, bytes, (off_t)offset);
+                if (count <= 0)
+                    throw std::runtime_error("Cannot read a temporary file of the external sort");
+
+                position += count;
+                bytes    -= count;
+                offset   += count;
+            }
+        }
+
+        /**
+         * @brief readAhead asks the kernel to start reading the range in the background
+         */
+        void readAhead(uint64_t offset, size_t bytes) const {
+#ifdef POSIX_FADV_WILLNEED
+            posix_fadvise(descriptor, (off_t)offset, (off_t)bytes, POSIX_FADV_WILLNEED);
+#endif
+        }
+    };
+
+    /**
+     * @brief The Run struct is a sorted run: "count" elements from the byte offset of a run file
+     */
+    struct Run {
+        uint64_t offset;
+        uint64_t count;
+    };
+
+    /**
+     * @brief The Cursor class reads a run block by block, the next block is requested from the kernel
+     *        while the current one is merged
+     */
+    template <typename T>
+    class Cursor {
+    private:
+        const RunFile* file;
+        uint64_t       offset;    // offset of the next block to read
+        uint64_t       remaining; // elements of the run not read yet
+
+        std::pmr::vector<T> block;
+        size_t              position;
+        size_t              end;
+
+    public:
+        size_t run; // index of the run, equal elements of earlier runs go first
+
+        Cursor(const RunFile& file, const Run& source, size_t blockElements, size_t run, std::pmr::memory_resource* resource)
+            : file(&file), offset(source.offset), remaining(source.count), block(blockElements, resource),
+              position(0), end(0), run(run) {
+            refill();
+        }
+
+        bool isEmpty() const {
+            return position == end;
+        }
+
+        const T& current() const {
+            return block[position];
+        }
+
+        /**
+         * @brief next moves to the next element and returns the number of bytes read from the disk to do it
+         */
+        size_t next() {
+            return ++position == end ? refill() : 0;
+        }
+
+        size_t refill() {
+            size_t count = (size_t)std::min<uint64_t>(remaining, block.size());
+
+            file->read(block.data(), count * sizeof(T), offset);
+
+            offset    += count * sizeof(T);
+            remaining -= count;
+            position   = 0;
+            end        = count;
+
+            if (remaining > 0)
+                file->readAhead(offset, (size_t)std::min<uint64_t>(remaining, block.size()) * sizeof(T));
+
+            return count * sizeof(T);
+        }
+    };
+
+    /**
+     * Worst time complexity - O(n * log(k)), where n - total size of the runs, k - number of the runs
+     *
+     * @brief mergeRuns merges the runs of the file with a binary heap of run cursors and passes the result
+     *        to output(const T* data, size_t count) in blocks of blockElements elements,
+     *        the blocks of the cursors and the output block are taken from the memory resource
+     * @return number of bytes read from the file
+     */
+    template <typename T, typename F>
+    uint64_t mergeRuns(const RunFile& file, const std::vector<Run>& runs, size_t blockElements, F output,
+                       std::pmr::memory_resource* resource) {
+        std::vector<Cursor<T>> cursors;
+        cursors.reserve(runs.size());
+
+        uint64_t bytesRead = 0;
+
+        for (const Run& run : runs) {
+            cursors.emplace_back(file, run, blockElements, cursors.size(), resource);
+            bytesRead += std::min<uint64_t>(run.count, blockElements) * sizeof(T);
+        }
+
+        // the root of the heap is the cursor with the least current element
+        auto greater = [&](size_t a, size_t b) {
+            const T& x = cursors[a].current();
+            const T& y = cursors[b].current();
+
+            return y < x || (!(x < y) && cursors[a].run > cursors[b].run);
+        };
+
+        std::vector<size_t> heap;
+        for (size_t i = 0; i < cursors.size(); i++)
+            if (!cursors[i].isEmpty())
+                heap.push_back(i);
+
+        std::make_heap(heap.begin(), heap.end(), greater);
+
+        std::pmr::vector<T> block(resource);
+        block.reserve(blockElements);
+
+        while (!heap.empty()) {
+            Cursor<T>& cursor = cursors[heap.front()];
+
+            block.push_back(cursor.current());
+
+            if (block.size() == blockElements) {
+                output(block.data(), block.size());
+                block.clear();
+            }
+
+            std::pop_heap(heap.begin(), heap.end(), greater);
+
+            bytesRead += cursor.next();
+
+            if (cursor.isEmpty())
+                heap.pop_back();
+            else
+                std::push_heap(heap.begin(), heap.end(), greater);
+        }
+
+        if (!block.empty())
+            output(block.data(), block.size());
+
+        return bytesRead;
+    }
+
+}
+
+/**
+ * @brief The ExternalMergeSort class sorts more elements than fit into memory
+ *
+ * Elements are pushed one by one into a buffer of half the memory budget, every full buffer is sorted by mergeSort,
+ * whose scratch buffer takes the other half, and written to a temporary file as a sorted run. Finishing merges the runs with a binary heap of run cursors,
+ * each cursor reads its run by large blocks and asks the kernel to read the next block ahead. If there are more runs
+ * than blocks fit into the budget, groups of runs are merged into longer runs first. The sort is stable,
+ * all the disk accesses are sequential reads and writes of whole blocks.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     mergeSort
+ * @param   <T> the type of elements, trivially copyable since they are written to disk as bytes
+ */
+template <typename T>
+class ExternalMergeSort {
+    static_assert(std::is_trivially_copyable<T>::value, "elements must be trivially copyable to be written to disk");
+
+private:
+    typedef external_merge_sort::Run     Run;
+    typedef external_merge_sort::RunFile RunFile;
+
+    std::string directory;
+    size_t      budgetElements; // elements that fit into the memory budget
+    size_t      bufferElements; // elements sorted in memory at once, the sort takes as many for its scratch buffer
+    size_t      blockElements;  // elements read or written by one disk access
+
+    std::pmr::memory_resource* resource;
+    std::pmr::vector<T>        buffer;
+
+    std::unique_ptr<RunFile> file;
+    std::vector<Run>         runs;
+
+    ExternalSortStatistics statistics_;
+
+    typedef std::chrono::steady_clock Clock;
+
+    static double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    void sortBuffer() {
+        mergeSort(buffer.begin(), buffer.end(), std::less<>(), IdentityProjection(), resource);
+    }
+
+    void writeRun() {
+        Clock::time_point start = Clock::now();
+
+        sortBuffer();
+
+        if (!file)
+            file.reset(new RunFile(directory));
+
+        runs.push_back({ file->size, buffer.size() });
+        file->append(buffer.data(), buffer.size() * sizeof(T));
+
+        statistics_.runs++;
+        statistics_.bytesWritten += buffer.size() * sizeof(T);
+        statistics_.runSeconds   += secondsSince(start);
+
+        buffer.clear();
+    }
+
+    template <typename F>
+    void finishTo(F output) {
+        if (runs.empty()) {
+            // everything fits into memory
+            Clock::time_point start = Clock::now();
+
+            sortBuffer();
+
+            for (size_t i = 0; i < buffer.size(); i += blockElements)
+                output(buffer.data() + i, std::min(blockElements, buffer.size() - i));
+
+            statistics_.runSeconds += secondsSince(start);
+
+            reset();
+            return;
+        }
+
+        if (!buffer.empty())
+            writeRun();
+
+        std::pmr::vector<T>(resource).swap(buffer); // the budget goes to the blocks of the merge
+
+        Clock::time_point start = Clock::now();
+
+        // one block for every cursor and one for the output
+        size_t fanIn = std::max<size_t>(2, budgetElements / blockElements - 1);
+
+        while (runs.size() > fanIn) {
+            std::unique_ptr<RunFile> merged(new RunFile(directory));
+            std::vector<Run>         mergedRuns;
+
+            for (size_t i = 0; i < runs.size(); i += fanIn) {
+                std::vector<Run> group(runs.begin() + i, runs.begin() + std::min(i + fanIn, runs.size()));
+
+                Run run = { merged->size, 0 };
+
+                statistics_.bytesRead += external_merge_sort::mergeRuns<T>(*file, group, blockElements,
+                    [&](const T* data, size_t count) {
+                        merged->append(data, count * sizeof(T));
+                        run.count += count;
+                    }, resource);
+
+                mergedRuns.push_back(run);
+                statistics_.bytesWritten += run.count * sizeof(T);
+            }
+
+            file.swap(merged);
+            runs.swap(mergedRuns);
+
+            statistics_.mergePasses++;
+        }
+
+        statistics_.bytesRead += external_merge_sort::mergeRuns<T>(*file, runs, blockElements, output, resource);
+        statistics_.mergePasses++;
+        statistics_.mergeSeconds += secondsSince(start);
+
+        reset();
+    }
+
+    void reset() {
+        file.reset();
+        runs.clear();
+        buffer.clear();
+        buffer.reserve(bufferElements);
+    }
+
+public:
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief ExternalMergeSort creates an empty sort
+     * @param memoryBudget - bytes the sort may use for elements: the in-memory buffer with the scratch buffer of its sort
+     *        and the blocks of the merge, all of them are taken from the memory resource
+     * @param directory - directory for the temporary files
+     * @param blockBytes - bytes read or written by one disk access
+     * @param resource - memory resource of the buffers and the blocks
+     */
+    explicit ExternalMergeSort(size_t memoryBudget, const std::string& directory = "/tmp", size_t blockBytes = 1 << 20,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : directory(directory), resource(resource), buffer(resource) {
+        budgetElements = std::max<size_t>(memoryBudget / sizeof(T), 16);
+        bufferElements = budgetElements / 2;
+        blockElements  = std::max<size_t>(std::min(blockBytes / sizeof(T), budgetElements / 3), 1);
+
+        buffer.reserve(bufferElements);
+    }
+
+    ExternalMergeSort(const ExternalMergeSort&)             = delete;
+    ExternalMergeSort& operator = (const ExternalMergeSort&) = delete;
+
+    /**
+     * Amortized time complexity - O(log(budget)), a full buffer is sorted and written to disk
+     *
+     * @brief push adds the element to the sort
+     * @param element - element to add
+     */
+    void push(const T& element) {
+        buffer.push_back(element);
+        statistics_.elements++;
+        statistics_.elementBytes += sizeof(T);
+
+        if (buffer.size() == bufferElements)
+            writeRun();
+    }
+
+    /**
+     * Worst time complexity - O(n * log(n)), where n - number of pushed elements,
+     * O(n * (1 + log(runs) / log(budget / block))) elements are read and written
+     *
+     * @brief finish passes the pushed elements in ascending order to output(const T* data, size_t count)
+     *        block by block, the sort is empty afterwards
+     * @param output - receiver of the sorted blocks
+     */
+    template <typename F>
+    void finish(F output) {
+        finishTo(output);
+    }
+
+    /**
+     * Worst time complexity - O(n * log(n)), where n - number of pushed elements
+     *
+     * @brief finish writes the pushed elements in ascending order into the binary file, the sort is empty afterwards
+     * @param path - path to the resulting file
+     */
+    void finish(const std::string& path) {
+        int descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (descriptor == -1)
+            throw std::runtime_error("Cannot create file " + path);
+
+        try {
+            finishTo([&](const T* data, size_t count) {
+                const char* position = reinterpret_cast<const char*>(data);
+                size_t      bytes    = count * sizeof(T);
+
+                while (bytes > 0) {
+                    ssize_t written = write(descriptor, position, bytes);
+                    if (written <= 0)
+                        throw std::runtime_error("Cannot write file " + path);
+
+                    position += written;
+                    bytes    -= written;
+                }
+
+                statistics_.bytesWritten += count * sizeof(T);
+            });
+        } catch (...) {
+            close(descriptor);
+            throw;
+        }
+
+        close(descriptor);
+    }
+
+    /**
+     * @brief statistics returns the counters of all the sorts finished so far and the one in progress
+     */
+    const ExternalSortStatistics& statistics() const {
+        return statistics_;
+    }
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include "algorithms/merge_sort.h"
+#include "algorithms/radix_sort.h"
+
+namespace indirect_sort {
+
+    /**
+     * @brief The KeyIndex struct is the key of an element together with the position of the element,
+     *        the index is 32-bit when the range is short enough to keep the pairs compact
+     */
+    template <typename K, typename I>
+    struct KeyIndex {
+        K key;
+        I index;
+    };
+
+    /**
+     * Worst time complexity - O(n * log(n)), O(d * n) for radix-sortable keys compared by std::less,
+     * where n = last - first, d - number of bytes of the key
+     *
+     * @brief sortIndexes puts the positions of the elements in the order of the stable sort of the range into "order"
+     */
+    template <typename I, typename RandomIt, typename Compare, typename Projection>
+    void sortIndexes(RandomIt first, RandomIt last, Compare compare, Projection projection, std::vector<size_t>& order) {
+        typedef typename std::iterator_traits<RandomIt>::reference Reference;
+        typedef typename std::decay<typename std::invoke_result<Projection&, Reference>::type>::type K;
+
+        size_t n = last - first;
+
+        std::vector<KeyIndex<K, I>> pairs;
+        pairs.reserve(n);
+
+        for (size_t i = 0; i < n; i++)
+            pairs.push_back({ std::invoke(projection, first[i]), (I)i });
+
+        constexpr bool isLess = std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<K>>::value;
+
+        if constexpr (isLess && radix_sort::isSortable<K>())
+            radixSort(pairs, [](const KeyIndex<K, I>& pair) { return radix_sort::DefaultKey()(pair.key); });
+        else
+            mergeSort(pairs.begin(), pairs.end(), compare, &KeyIndex<K, I>::key);
+
+        order.resize(n);
+        for (size_t i = 0; i < n; i++)
+            order[i] = pairs[i].index;
+    }
+
+}
+
+/**
+ * Worst time complexity - O(n * log(n)), O(d * n) for integer, floating point and Date keys compared by std::less,
+ * where n = last - first, d - number of bytes of the key
+ *
+ * @brief argsort - stable sort of the positions of the elements by their keys: pairs (key, position) are sorted
+ *        instead of the elements, the elements are not changed
+ * @param first - beginning of the range
+ * @param last - end of the range
+ * @param compare - compare(key1, key2) is true if key1 goes before key2
+ * @param projection - projection(element) returns the key of the element, may be a pointer to a member
+ * @return positions of the elements in the sorted order
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = IdentityProjection>
+std::vector<size_t> argsort(RandomIt first, RandomIt last, Compare compare = Compare(), Projection projection = Projection()) {
+    std::vector<size_t> order;
+
+    if ((size_t)(last - first) <= UINT32_MAX)
+        indirect_sort::sortIndexes<uint32_t>(first, last, compare, projection, order);
+    else
+        indirect_sort::sortIndexes<uint64_t>(first, last, compare, projection, order);
+
+    return order;
+}
+
+/**
+ * Worst time complexity - O(n) (linear), where n = last - first
+ *
+ * @brief applyPermutation rearranges the range in place so that the element at position order[i] goes to position i,
+ *        every cycle of the permutation is followed once, so every element is moved exactly once plus one move per cycle
+ * @param first - beginning of the range
+ * @param last - end of the range
+ * @param order - permutation of the positions, it is destroyed
+ */
+template <typename RandomIt>
+void applyPermutation(RandomIt first, RandomIt last, std::vector<size_t>& order) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+
+    size_t n = last - first;
+
+    for (size_t start = 0; start < n; start++) {
+        if (order[start] == start)
+            continue;
+
+        T      element  = std::move(first[start]);
+        size_t position = start;
+
+        while (order[position] != start) {
+            size_t next = order[position];
+
+            first[position] = std::move(first[next]);
+            order[position] = position; // the position is filled
+            position        = next;
+        }
+
+        first[position] = std::move(element);
+        order[position] = position;
+    }
+}
+
+/**
+ * Worst time complexity - O(n * log(n)), O(d * n) for integer, floating point and Date keys compared by std::less,
+ * where n = last - first, d - number of bytes of the key
+ *
+ * @brief indirectSort - stable sort of a range of heavy elements by their keys: pairs (key, position) are sorted
+ *        by argsort, then the permutation is applied in place, so every element is moved only about once
+ * @param first - beginning of the range
+ * @param last - end of the range
+ * @param compare - compare(key1, key2) is true if key1 goes before key2
+ * @param projection - projection(element) returns the key of the element, may be a pointer to a member
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = IdentityProjection>
+void indirectSort(RandomIt first, RandomIt last, Compare compare = Compare(), Projection projection = Projection()) {
+    std::vector<size_t> order = argsort(first, last, compare, projection);
+
+    applyPermutation(first, last, order);
+}
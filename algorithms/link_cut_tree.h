@@ -0,0 +1,266 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+/**
+ * @brief The LinkCutTree class implements a forest of rooted trees stored as splay trees of preferred paths,
+ *        it links and cuts trees and finds the heaviest node on a path in amortized O(log(n))
+ *
+ * Every node may carry a weight. Nodes without a weight (for example vertices, when edges of a graph
+ * are stored as separate weighted nodes) are never reported as the heaviest ones.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @param   <W> the type of weights
+ */
+template <typename W>
+class LinkCutTree {
+private:
+    /**
+     * @brief The Node struct is a node of a splay tree of a preferred path
+     */
+    struct Node {
+        int  child[2];
+        int  parent;
+        bool reversed;  // children of the whole subtree have to be swapped
+        bool hasWeight;
+        W    weight;
+        int  heaviest;  // the heaviest weighted node of the subtree, -1 if there is no such node
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int>  freeNodes;
+    std::vector<int>  path; // nodes from the splayed node up to the root of its splay tree
+
+    bool isSplayRoot(int x) const {
+        int p = nodes[x].parent;
+
+        return p == -1 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+    }
+
+    void pull(int x) {
+        Node& node = nodes[x];
+
+        node.heaviest = node.hasWeight ? x : -1;
+
+        for (int c : node.child) {
+            if (c == -1 || nodes[c].heaviest == -1)
+                continue;
+
+            if (node.heaviest == -1 || nodes[node.heaviest].weight < nodes[nodes[c].heaviest].weight)
+                node.heaviest = nodes[c].heaviest;
+        }
+    }
+
+    void push(int x) {
+        Node& node = nodes[x];
+
+        if (!node.reversed)
+            return;
+
+        std::swap(node.child[0], node.child[1]);
+
+        for (int c : node.child)
+            if (c != -1)
+                nodes[c].reversed = !nodes[c].reversed;
+
+        node.reversed = false;
+    }
+
+    void rotate(int x) {
+        int p    = nodes[x].parent;
+        int g    = nodes[p].parent;
+        int side = nodes[p].child[1] == x ? 1 : 0;
+
+        if (!isSplayRoot(p))
+            nodes[g].child[nodes[g].child[1] == p ? 1 : 0] = x;
+        nodes[x].parent = g;
+
+        nodes[p].child[side] = nodes[x].child[side ^ 1];
+        if (nodes[p].child[side] != -1)
+            nodes[nodes[p].child[side]].parent = p;
+
+        nodes[x].child[side ^ 1] = p;
+        nodes[p].parent          = x;
+
+        pull(p);
+        pull(x);
+    }
+
+    void splay(int x) {
+        path.clear();
+
+        for (int y = x; ; y = nodes[y].parent) {
+            path.push_back(y);
+            if (isSplayRoot(y))
+                break;
+        }
+
+        for (auto it = path.rbegin(); it != path.rend(); ++it)
+            push(*it);
+
+        while (!isSplayRoot(x)) {
+            int p = nodes[x].parent;
+
+            if (!isSplayRoot(p)) {
+                int g = nodes[p].parent;
+
+                bool zigZig = (nodes[g].child[1] == p) == (nodes[p].child[1] == x);
+                rotate(zigZig ? p : x);
+            }
+
+            rotate(x);
+        }
+    }
+
+    void access(int x) {
+        for (int y = x, last = -1; y != -1; last = y, y = nodes[y].parent) {
+            splay(y);
+            nodes[y].child[1] = last;
+            pull(y);
+        }
+
+        splay(x);
+    }
+
+    void makeRoot(int x) {
+        access(x);
+        nodes[x].reversed = !nodes[x].reversed;
+    }
+
+    int findRoot(int x) {
+        access(x);
+
+        while (true) {
+            push(x);
+            if (nodes[x].child[0] == -1)
+                break;
+            x = nodes[x].child[0];
+        }
+
+        splay(x);
+
+        return x;
+    }
+
+public:
+    /**
+     * Amortized time complexity - O(1)
+     *
+     * @brief addNode creates a new tree of one node without a weight
+     * @return id of the node
+     */
+    int addNode() {
+        int x;
+
+        if (!freeNodes.empty()) {
+            x = freeNodes.back();
+            freeNodes.pop_back();
+        } else {
+            x = (int)nodes.size();
+            nodes.emplace_back();
+        }
+
+        nodes[x].child[0] = nodes[x].child[1] = nodes[x].parent = -1;
+        nodes[x].reversed  = false;
+        nodes[x].hasWeight = false;
+        nodes[x].heaviest  = -1;
+
+        return x;
+    }
+
+    /**
+     * Amortized time complexity - O(1)
+     *
+     * @brief addNode creates a new tree of one weighted node
+     * @param weight - weight of the node
+     * @return id of the node
+     */
+    int addNode(const W& weight) {
+        int x = addNode();
+
+        nodes[x].hasWeight = true;
+        nodes[x].weight    = weight;
+        nodes[x].heaviest  = x;
+
+        return x;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief removeNode frees the id of a node that is not linked to any other node
+     * @param x - id of the node
+     */
+    void removeNode(int x) {
+        freeNodes.push_back(x);
+    }
+
+    /**
+     * Amortized time complexity - O(log(n))
+     *
+     * @brief connected returns true if two nodes are in the same tree
+     * @param x - first node
+     * @param y - second node
+     * @return true if two nodes are in the same tree
+     */
+    bool connected(int x, int y) {
+        return x == y || findRoot(x) == findRoot(y);
+    }
+
+    /**
+     * Amortized time complexity - O(log(n))
+     *
+     * @brief link connects two nodes from different trees by an edge
+     * @param x - first node
+     * @param y - second node
+     */
+    void link(int x, int y) {
+        makeRoot(x);
+        nodes[x].parent = y;
+    }
+
+    /**
+     * Amortized time complexity - O(log(n))
+     *
+     * @brief cut removes the edge between two adjacent nodes
+     * @param x - first node
+     * @param y - second node
+     */
+    void cut(int x, int y) {
+        makeRoot(x);
+        access(y);
+
+        // x is the only node before y on the path from the root
+        nodes[y].child[0] = -1;
+        nodes[x].parent   = -1;
+        pull(y);
+    }
+
+    /**
+     * Amortized time complexity - O(log(n))
+     *
+     * @brief heaviestOnPath returns the heaviest weighted node on the path between two connected nodes
+     * @param x - first node
+     * @param y - second node
+     * @return id of the heaviest weighted node, -1 if there are no weighted nodes on the path
+     */
+    int heaviestOnPath(int x, int y) {
+        makeRoot(x);
+        access(y);
+
+        return nodes[y].heaviest;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief weight returns the weight of a weighted node
+     * @param x - id of the node
+     * @return the weight of the node
+     */
+    const W& weight(int x) const {
+        return nodes[x].weight;
+    }
+};
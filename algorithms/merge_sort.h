@@ -1,19 +1,39 @@
 #pragma once
 
 #include <vector>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <memory_resource>
+
+#include "algorithms/simd_sort.h"
+#include "algorithms/radix_sort.h"
+
+/**
+ * @brief The SortEngine enum selects the algorithm used by mergeSort
+ */
+enum class SortEngine {
+    MergeSort, // comparison merge sort
+    Simd,      // sorting networks (see simdSort), used for int, long long, float, double and Date, other types
+               // are merge sorted, the networks are vectorized with AVX2 only and are slower than MergeSort without it
+    RadixSort  // LSD radix sort, used for integers, float, double and Date, other types are merge sorted
+};
 
 /**
  * Worst time complexity - O(right - left) (linear)
  *
- * @brief merge - merge two parts of a vector together
+ * @brief merge - merge two parts of a vector together through a buffer
  * @param vector - vector that contains elements
  * @param left - beginning of the first array
  * @param mid - end of the first and beggining of the second array
  * @param right - end of the second array
+ * @param mergedVector - buffer for the merged elements, it is grown to right - left elements if it is shorter
  */
 template <typename T>
-void merge(std::vector<T>& vector, size_t left, size_t mid, size_t right) {
-    std::vector<T> mergedVector(right - left);
+void merge(std::vector<T>& vector, size_t left, size_t mid, size_t right, std::pmr::vector<T>& mergedVector) {
+    if (mergedVector.size() < right - left)
+        mergedVector.resize(right - left);
 
     size_t leftIterator  = left;
     size_t rightIterator = mid;
@@ -31,15 +51,154 @@ void merge(std::vector<T>& vector, size_t left, size_t mid, size_t right) {
         vector[i] = mergedVector[i - left];
 }
 
+/**
+ * Worst time complexity - O(right - left) (linear)
+ *
+ * @brief merge - merge two parts of a vector together
+ * @param vector - vector that contains elements
+ * @param left - beginning of the first array
+ * @param mid - end of the first and beggining of the second array
+ * @param right - end of the second array
+ */
+template <typename T>
+void merge(std::vector<T>& vector, size_t left, size_t mid, size_t right) {
+    std::pmr::vector<T> mergedVector(right - left);
+
+    merge(vector, left, mid, right, mergedVector);
+}
+
+/**
+ * Worst time complexity - O(n * log(n)), where n = right - left
+ *
+ * @brief mergeSort - merge sort of the part [left, right) of a vector, all the merges go through one buffer
+ * @param vector - vector that contains elements
+ * @param left - beginning of the part
+ * @param right - end of the part
+ * @param resource - memory resource of the buffer
+ */
+template <typename T>
+void mergeSort(std::vector<T>& vector, size_t left, size_t right,
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    std::pmr::vector<T> buffer(resource);
+
+    for (size_t i = 1; i < right - left; i *= 2)
+        for (size_t j = left; j < right - i; j += 2 * i)
+            merge(vector, j, j + i, std::min(j + 2 * i, right), buffer);
+}
+
 /**
  * Worst time complexity - O(n * log(n), where n - size of a vector
  *
  * @brief mergeSort - merge sort of a vector
  * @param vector - vector to sort
+ * @param resource - memory resource of the buffer
+ */
+template <typename T>
+void mergeSort(std::vector<T>& vector, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    mergeSort(vector, 0, vector.size(), resource);
+}
+
+/**
+ * Worst time complexity - O(n * log(n)) for MergeSort and Simd, O(d * n) for RadixSort, where n - size of a vector,
+ * d - number of bytes of the elements
+ *
+ * @brief mergeSort - stable sort of a vector by the chosen algorithm
+ * @param vector - vector to sort
+ * @param engine - algorithm to sort with
+ * @param resource - memory resource of the buffers
  */
 template <typename T>
-void mergeSort(std::vector<T>& vector) {
-    for (size_t i = 1; i < vector.size(); i *= 2)
-        for (size_t j = 0; j < vector.size() - i; j += 2 * i)
-            merge(vector, j, j + i, min(j + 2 * i, vector.size()));
+void mergeSort(std::vector<T>& vector, SortEngine engine,
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    if constexpr (radix_sort::isSortable<T>()) {
+        if (engine == SortEngine::RadixSort) {
+            radixSort(vector, radix_sort::DefaultKey(), resource);
+            return;
+        }
+    }
+
+    if constexpr (simd_sort::isSupported<T>()) {
+        if (engine == SortEngine::Simd) {
+            simdSort(vector, resource);
+            return;
+        }
+    }
+
+    mergeSort(vector, resource);
+}
+
+/**
+ * @brief The IdentityProjection struct is the default key projection: the element is its own key
+ */
+struct IdentityProjection {
+    template <typename T>
+    T&& operator () (T&& element) const {
+        return std::forward<T>(element);
+    }
+};
+
+/**
+ * Worst time complexity - O(n * log(n)), where n = last - first
+ *
+ * @brief mergeSort - stable merge sort of a range by the keys of its elements: blocks of 16 elements are sorted
+ *        by insertion, then merged pairwise back and forth between the range and one buffer, elements are moved
+ *        and never copied
+ * @param first - beginning of the range
+ * @param last - end of the range
+ * @param compare - compare(key1, key2) is true if key1 goes before key2
+ * @param projection - projection(element) returns the key of the element, may be a pointer to a member
+ * @param resource - memory resource of the buffer
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = IdentityProjection,
+          typename = typename std::iterator_traits<RandomIt>::iterator_category>
+void mergeSort(RandomIt first, RandomIt last, Compare compare = Compare(), Projection projection = Projection(),
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+
+    const size_t BLOCK = 16;
+
+    size_t n = last - first;
+
+    auto less = [&](const T& element1, const T& element2) {
+        return compare(std::invoke(projection, element1), std::invoke(projection, element2));
+    };
+
+    for (size_t begin = 0; begin < n; begin += BLOCK) {
+        RandomIt blockEnd = first + std::min(begin + BLOCK, n);
+
+        for (RandomIt i = first + begin + 1; i < blockEnd; ++i) {
+            T        element = std::move(*i);
+            RandomIt j       = i;
+
+            for (; j > first + begin && less(element, *(j - 1)); --j)
+                *j = std::move(*(j - 1));
+
+            *j = std::move(element);
+        }
+    }
+
+    if (n <= BLOCK)
+        return;
+
+    std::pmr::vector<T> buffer(n, resource);
+    bool                inBuffer = false;
+
+    for (size_t run = BLOCK; run < n; run *= 2, inBuffer = !inBuffer) {
+        for (size_t left = 0; left < n; left += 2 * run) {
+            size_t mid   = std::min(left + run, n);
+            size_t right = std::min(left + 2 * run, n);
+
+            if (inBuffer)
+                std::merge(std::make_move_iterator(buffer.begin() + left), std::make_move_iterator(buffer.begin() + mid),
+                           std::make_move_iterator(buffer.begin() + mid), std::make_move_iterator(buffer.begin() + right),
+                           first + left, less);
+            else
+                std::merge(std::make_move_iterator(first + left), std::make_move_iterator(first + mid),
+                           std::make_move_iterator(first + mid), std::make_move_iterator(first + right),
+                           buffer.begin() + left, less);
+        }
+    }
+
+    if (inBuffer)
+        std::move(buffer.begin(), buffer.end(), first);
 }
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+/**
+ * Worst case time complexity - O(count / threads) with "threads" cores, plus the cost of the function
+ *
+ * @brief parallelFor splits [0, count) into contiguous ranges and calls function(begin, end, thread) for each of them
+ *        on its own std::thread, the calling thread waits for all of them, one range is processed without new threads
+ * @param count - number of items
+ * @param threads - number of threads, 0 means std::thread::hardware_concurrency()
+ * @param function - callback for every range
+ * @return the number of ranges (never more than count, at least 1)
+ */
+template <typename F>
+unsigned parallelFor(size_t count, unsigned threads, F function) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = (unsigned)std::max<size_t>(1, std::min<size_t>(threads, count));
+
+    if (threads == 1) {
+        function((size_t)0, count, 0u);
+        return 1;
+    }
+
+    std::vector<std::thread> workers;
+
+    for (unsigned i = 0; i < threads; i++)
+        workers.emplace_back(function, count * i / threads, count * (i + 1) / threads, i);
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return threads;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include "algorithms/merge_sort.h"
+#include "algorithms/thread_pool.h"
+
+/**
+ * Worst time complexity - O(log(min(k, n)))
+ *
+ * @brief coRank finds how many of the first k elements of the stable merge of a[0, n) and b[0, m) come from a,
+ *        equal elements of a go before the ones of b
+ * @param k - number of elements of the merge
+ * @param a - first sorted array
+ * @param n - size of the first array
+ * @param b - second sorted array
+ * @param m - size of the second array
+ * @return number of elements taken from a
+ */
+template <typename T>
+size_t coRank(size_t k, const T* a, size_t n, const T* b, size_t m) {
+    size_t low  = k > m ? k - m : 0;
+    size_t high = std::min(k, n);
+
+    while (low < high) {
+        size_t i = low + (high - low) / 2;
+        size_t j = k - i;
+
+        if (j > 0 && i < n && !(b[j - 1] < a[i]))
+            low = i + 1;  // a[i] belongs to the first k elements
+        else
+            high = i;
+    }
+
+    return low;
+}
+
+/**
+ * Worst time complexity - O(n * log(n) / threads + n) with "threads" cores, where n - size of a vector
+ *
+ * @brief parallelMergeSort - stable merge sort of a vector on the thread pool: chunks are sorted by mergeSort
+ *        as separate tasks, then every level of pairwise merges is split by coRank into pieces of equal size
+ *        that are merged in parallel, levels go back and forth between the vector and one buffer
+ * @param vector - vector to sort
+ * @param pool - pool to run the tasks on
+ */
+template <typename T>
+void parallelMergeSort(std::vector<T>& vector, ThreadPool& pool) {
+    size_t n = vector.size();
+
+    // a few chunks per worker let the pool balance them
+    size_t chunks = std::min<size_t>(pool.size() * 4, std::max<size_t>(1, n / 1024));
+
+    std::vector<size_t> bounds;
+    for (size_t i = 0; i <= chunks; i++)
+        bounds.push_back(n * i / chunks);
+
+    for (size_t i = 0; i < chunks; i++)
+        pool.submit([&vector, &bounds, i]() { mergeSort(vector, bounds[i], bounds[i + 1]); });
+
+    pool.wait();
+
+    if (chunks == 1)
+        return;
+
+    std::vector<T> buffer(n);
+
+    T* from = vector.data();
+    T* to   = buffer.data();
+
+    size_t piece = std::max<size_t>(4096, n / (pool.size() * 4));
+
+    while (bounds.size() > 2) {
+        std::vector<size_t> merged;
+
+        for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+            merged.push_back(bounds[i]);
+
+            size_t left  = bounds[i];
+            size_t mid   = bounds[i + 1];
+            size_t right = i + 2 < bounds.size() ? bounds[i + 2] : mid;
+
+            for (size_t k = 0; k < right - left; k += piece) {
+                pool.submit([=]() {
+                    size_t end = std::min(k + piece, right - left);
+
+                    const T* a = from + left;
+                    const T* b = from + mid;
+
+                    size_t aBegin = coRank(k, a, mid - left, b, right - mid);
+                    size_t aEnd   = coRank(end, a, mid - left, b, right - mid);
+
+                    std::merge(std::make_move_iterator(from + left + aBegin),
+                               std::make_move_iterator(from + left + aEnd),
+                               std::make_move_iterator(from + mid + (k - aBegin)),
+                               std::make_move_iterator(from + mid + (end - aEnd)),
+                               to + left + k);
+                });
+            }
+        }
+
+        merged.push_back(n);
+
+        pool.wait();
+
+        bounds.swap(merged);
+        std::swap(from, to);
+    }
+
+    if (from != vector.data()) {
+        T* result = from;
+        T* target = vector.data();
+
+        for (size_t k = 0; k < n; k += piece)
+            pool.submit([=]() { std::move(result + k, result + std::min(k + piece, n), target + k); });
+
+        pool.wait();
+    }
+}
+
+/**
+ * Worst time complexity - O(n * log(n) / threads + n) with "threads" cores, where n - size of a vector
+ *
+ * @brief parallelMergeSort - stable merge sort of a vector on a new thread pool, small vectors are sorted by mergeSort
+ * @param vector - vector to sort
+ * @param threads - number of threads, 0 means std::thread::hardware_concurrency()
+ */
+template <typename T>
+void parallelMergeSort(std::vector<T>& vector, unsigned threads = 0) {
+    if (threads == 1 || vector.size() < 8192) {
+        mergeSort(vector);
+        return;
+    }
+
+    ThreadPool pool(threads);
+
+    parallelMergeSort(vector, pool);
+}
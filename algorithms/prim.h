@@ -5,34 +5,48 @@
 #include <climits>
 
 #include "graph/graph_on_adjacency_matrix.h"
+#include "graph/graph_on_adjacency_list.h"
+#include "graph/csr_graph.h"
+#include "graph/graph_file.h"
 #include "fibonacci_heap/fibonacci_heap.h"
 #include "fibonacci_heap/fibonacci_heap_node.h"
 #include "graph/edge.h"
-#include "graph/graph_on_adjacency_matrix.h"
+#include "algorithms/boruvka.h"
 
 /**
- * Worst case time complexity - O(E + V*log(V))
+ * @brief The MsfEngine enum selects the algorithm used by GetMinSpanningForest, every engine takes a directed edge
+ *        as an undirected edge between its ends, so all of them return forests of the same weight on any graph
+ */
+enum class MsfEngine {
+    LazyPrim,       // Prim with one heap node per edge, stale nodes are skipped on extraction
+    EagerPrim,      // Prim with one heap node per vertex updated by decreaseKey
+    ParallelBoruvka // Borůvka on several threads with concurrent union-find
+};
+
+/**
+ * Worst case time complexity - O(E*log(E))
  *
- * @brief GetMinSpanningForest uses Prim algorithm to put in the array "forest" the minnimum spanning forest og the given graph
+ * @brief PrimOnIndexes runs Prim algorithm on any graph that provides indexCount, indexExist,
+ *        vertexAt and forEachNeighbor and puts in the array "forest" the minimum spanning forest
  * @param graph - given graph
  * @param forest - resulting array
  */
-template <typename V, typename E>
-void GetMinSpanningForest(AdjacencyMatrix<V, E> &graph, std::vector<std::pair<std::string, std::string>>& forest) {
+template <typename G, typename V>
+void PrimOnIndexes(const G& graph, std::vector<std::pair<V, V>>& forest) {
     std::unordered_set<int> isVisited;
 
-    for (int i = 0; i < graph.lastIndex; i++) {
-        if (isVisited.count(i) == 1)
+    for (int i = 0; i < graph.indexCount(); i++) {
+        if (!graph.indexExist(i) || isVisited.count(i) == 1)
             continue;
 
         isVisited.insert(i);
 
         FibonacciHeap<double, Edge> minEdges(-10000000);
 
-        for (const int& vertex : graph.neighbors[i]) {
+        graph.forEachNeighbor(i, [&](int vertex, const auto& weight) {
             if (isVisited.count(vertex) == 0)
-                minEdges.insert(new Node(graph.matrix[i][vertex], Edge(i, vertex)));
-        }
+                minEdges.insert(new Node<double, Edge>(weight, Edge(i, vertex)));
+        });
 
         while (!minEdges.isEmpty()) {
             auto* node = minEdges.extractMin();
@@ -43,27 +57,275 @@ void GetMinSpanningForest(AdjacencyMatrix<V, E> &graph, std::vector<std::pair<st
 
             Edge edge = node->value;
 
-            forest.push_back({ graph.vertexByIndex[edge.vertex1], graph.vertexByIndex[edge.vertex2] });
+            forest.push_back({ graph.vertexAt(edge.vertex1), graph.vertexAt(edge.vertex2) });
 
             isVisited.insert(edge.vertex2);
 
-            for (const int& vertex : graph.neighbors[edge.vertex2]) {
+            graph.forEachNeighbor(edge.vertex2, [&](int vertex, const auto& weight) {
                 if (isVisited.count(vertex) == 0)
-                    minEdges.insert(new Node(graph.matrix[edge.vertex2][vertex], Edge(edge.vertex2, vertex)));
-            }
+                    minEdges.insert(new Node<double, Edge>(weight, Edge(edge.vertex2, vertex)));
+            });
 
             delete node;
         }
     }
 }
 
+/**
+ * Amortized time complexity - O(E + V*log(V))
+ *
+ * @brief EagerPrimOnIndexes runs Prim algorithm keeping at most one heap node per vertex, keys of the nodes are
+ *        lowered with decreaseKey, so the heap never holds more than V nodes and no node is allocated per edge
+ * @param graph - given graph providing indexCount, indexExist, vertexAt and forEachNeighbor
+ * @param forest - resulting array
+ */
+template <typename G, typename V>
+void EagerPrimOnIndexes(const G& graph, std::vector<std::pair<V, V>>& forest) {
+    int n = graph.indexCount();
+
+    std::vector<bool> isVisited(n, false);
+    std::vector<int>  parent(n, -1);
+
+    std::vector<Node<double, int>*> handle(n, nullptr);
+    std::vector<Node<double, int>>  nodes; // storage for all the nodes, never reallocated
+    nodes.reserve(n);
+
+    FibonacciHeap<double, int> minVertices(-10000000);
+
+    for (int i = 0; i < n; i++) {
+        if (!graph.indexExist(i) || isVisited[i])
+            continue;
+
+        nodes.emplace_back(0, i);
+        handle[i] = &nodes.back();
+        minVertices.insert(handle[i]);
+
+        while (!minVertices.isEmpty()) {
+            int vertex = minVertices.extractMin()->value;
+
+            isVisited[vertex] = true;
+
+            if (parent[vertex] != -1)
+                forest.push_back({ graph.vertexAt(parent[vertex]), graph.vertexAt(vertex) });
+
+            graph.forEachNeighbor(vertex, [&](int to, const auto& weight) {
+                if (isVisited[to])
+                    return;
+
+                if (handle[to] == nullptr) {
+                    nodes.emplace_back(weight, to);
+                    handle[to] = &nodes.back();
+                    parent[to] = vertex;
+
+                    minVertices.insert(handle[to]);
+                } else if (weight < handle[to]->key) {
+                    parent[to] = vertex;
+
+                    minVertices.decreaseKey(handle[to], weight);
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @brief The UndirectedIndexView struct is the index-level view of a graph in which the neighbors of a vertex are
+ *        the targets of its outgoing edges and the sources of its incoming edges, so Prim sees every edge from both ends
+ *        as Borůvka does
+ */
+template <typename G, typename E>
+struct UndirectedIndexView {
+    const G& graph;
+
+    std::vector<size_t> offsets; // incoming edges of the index i are sources[offsets[i] .. offsets[i + 1])
+    std::vector<int>    sources;
+    std::vector<E>      weights;
+
+    int indexCount() const {
+        return graph.indexCount();
+    }
+
+    bool indexExist(int index) const {
+        return graph.indexExist(index);
+    }
+
+    decltype(auto) vertexAt(int index) const {
+        return graph.vertexAt(index);
+    }
+
+    template <typename F>
+    void forEachNeighbor(int index, F function) const {
+        graph.forEachNeighbor(index, function);
+
+        for (size_t i = offsets[index]; i != offsets[index + 1]; i++)
+            function(sources[i], weights[i]);
+    }
+};
+
+/**
+ * Worst case time complexity - O(V + E)
+ *
+ * @brief buildIncomingEdges puts the incoming edges of every index of the graph into the view by counting sort,
+ *        the sources of every index go in ascending order, loops are left out
+ * @return true if the graph is symmetric: every index has an outgoing edge of the same weight
+ *         for each of its incoming edges, then the view is not needed
+ */
+template <typename G, typename E>
+bool buildIncomingEdges(UndirectedIndexView<G, E>& view) {
+    const G& graph = view.graph;
+
+    int n = graph.indexCount();
+
+    view.offsets.assign(n + 1, 0);
+
+    for (int i = 0; i < n; i++)
+        if (graph.indexExist(i))
+            graph.forEachNeighbor(i, [&](int to, const auto&) {
+                if (to != i)
+                    view.offsets[to + 1]++;
+            });
+
+    for (int i = 0; i < n; i++)
+        view.offsets[i + 1] += view.offsets[i];
 
+    view.sources.resize(view.offsets[n]);
+    view.weights.resize(view.offsets[n]);
 
+    std::vector<size_t> next(view.offsets.begin(), view.offsets.end() - 1);
 
+    for (int i = 0; i < n; i++)
+        if (graph.indexExist(i))
+            graph.forEachNeighbor(i, [&](int to, const auto& weight) {
+                if (to != i) {
+                    view.sources[next[to]] = i;
+                    view.weights[next[to]] = weight;
+                    next[to]++;
+                }
+            });
 
+    // sorting the incoming edges once more by source gives the outgoing edges of every index sorted by target,
+    // the graph is symmetric if they are the same as the incoming edges
+    std::vector<size_t> outgoing(n + 1, 0);
 
+    for (int source : view.sources)
+        outgoing[source + 1]++;
 
+    for (int i = 0; i < n; i++)
+        outgoing[i + 1] += outgoing[i];
 
+    std::vector<int> targets(view.sources.size());
+    std::vector<E>   targetWeights(view.sources.size());
 
+    next.assign(outgoing.begin(), outgoing.end() - 1);
 
+    for (int to = 0; to < n; to++)
+        for (size_t i = view.offsets[to]; i != view.offsets[to + 1]; i++) {
+            int source = view.sources[i];
 
+            targets[next[source]]       = to;
+            targetWeights[next[source]] = view.weights[i];
+            next[source]++;
+        }
+
+    return outgoing == view.offsets && targets == view.sources && targetWeights == view.weights;
+}
+
+/**
+ * @brief SpanningForestOnIndexes runs the selected engine on any graph that provides the index-level view,
+ *        Prim engines of a graph with asymmetric edges run on its UndirectedIndexView
+ * @param graph - given graph
+ * @param forest - resulting array
+ * @param engine - algorithm to use
+ * @param threads - number of threads of parallel engines, 0 means std::thread::hardware_concurrency()
+ */
+template <template <typename, typename> class G, typename V, typename E>
+void SpanningForestOnIndexes(const G<V, E>& graph, std::vector<std::pair<V, V>>& forest, MsfEngine engine,
+                             unsigned threads = 0)
+{
+    // Borůvka takes every edge as undirected itself
+    if (engine == MsfEngine::ParallelBoruvka) {
+        ParallelBoruvkaOnIndexes(graph, forest, threads);
+        return;
+    }
+
+    UndirectedIndexView<G<V, E>, E> view = { graph, { }, { }, { } };
+
+    if (buildIncomingEdges(view)) {
+        std::vector<size_t>().swap(view.offsets);
+        std::vector<int>().swap(view.sources);
+        std::vector<E>().swap(view.weights);
+
+        if (engine == MsfEngine::EagerPrim)
+            EagerPrimOnIndexes(graph, forest);
+        else
+            PrimOnIndexes(graph, forest);
+    } else {
+        if (engine == MsfEngine::EagerPrim)
+            EagerPrimOnIndexes(view, forest);
+        else
+            PrimOnIndexes(view, forest);
+    }
+}
+
+/**
+ * Worst case time complexity - O(E + V*log(V))
+ *
+ * @brief GetMinSpanningForest uses Prim algorithm to put in the array "forest" the minnimum spanning forest og the given graph
+ * @param graph - given graph
+ * @param forest - resulting array
+ * @param engine - algorithm to use, lazy Prim by default
+ * @param threads - number of threads of parallel engines, 0 means std::thread::hardware_concurrency()
+ */
+template <typename V, typename E>
+void GetMinSpanningForest(AdjacencyMatrix<V, E> &graph, std::vector<std::pair<V, V>>& forest,
+                          MsfEngine engine = MsfEngine::LazyPrim, unsigned threads = 0) {
+    SpanningForestOnIndexes(graph, forest, engine, threads);
+}
+
+/**
+ * Worst case time complexity - O(E + V*log(V))
+ *
+ * @brief GetMinSpanningForest uses Prim algorithm to put in the array "forest" the minnimum spanning forest
+ *        of the given graph stored in adjacency lists
+ * @param graph - given graph
+ * @param forest - resulting array
+ * @param engine - algorithm to use, lazy Prim by default
+ * @param threads - number of threads of parallel engines, 0 means std::thread::hardware_concurrency()
+ */
+template <typename V, typename E>
+void GetMinSpanningForest(AdjacencyList<V, E> &graph, std::vector<std::pair<V, V>>& forest,
+                          MsfEngine engine = MsfEngine::LazyPrim, unsigned threads = 0) {
+    SpanningForestOnIndexes(graph, forest, engine, threads);
+}
+
+/**
+ * Worst case time complexity - O(E + V*log(V))
+ *
+ * @brief GetMinSpanningForest uses Prim algorithm to put in the array "forest" the minnimum spanning forest
+ *        of the given compressed sparse row snapshot
+ * @param graph - given snapshot
+ * @param forest - resulting array
+ * @param engine - algorithm to use, lazy Prim by default
+ * @param threads - number of threads of parallel engines, 0 means std::thread::hardware_concurrency()
+ */
+template <typename V, typename E>
+void GetMinSpanningForest(const CSRGraph<V, E> &graph, std::vector<std::pair<V, V>>& forest,
+                          MsfEngine engine = MsfEngine::LazyPrim, unsigned threads = 0) {
+    SpanningForestOnIndexes(graph, forest, engine, threads);
+}
+
+/**
+ * Worst case time complexity - O(E + V*log(V))
+ *
+ * @brief GetMinSpanningForest uses Prim algorithm to put in the array "forest" the minnimum spanning forest
+ *        of the given memory-mapped graph file
+ * @param graph - given mapped graph
+ * @param forest - resulting array
+ * @param engine - algorithm to use, lazy Prim by default
+ * @param threads - number of threads of parallel engines, 0 means std::thread::hardware_concurrency()
+ */
+template <typename V, typename E>
+void GetMinSpanningForest(const MappedGraph<V, E> &graph, std::vector<std::pair<V, V>>& forest,
+                          MsfEngine engine = MsfEngine::LazyPrim, unsigned threads = 0) {
+    SpanningForestOnIndexes(graph, forest, engine, threads);
+}
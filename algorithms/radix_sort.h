@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <memory_resource>
+
+#include "algorithms/date.h"
+
+namespace radix_sort {
+
+    const size_t DIGIT_BITS = 8;
+    const size_t BUCKETS    = 1 << DIGIT_BITS;
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief orderedBits maps the key to an unsigned integer of the same order: the sign bit of signed integers
+     *        is flipped, all the bits of negative floating point numbers and the sign bit of the others are flipped,
+     *        -0.0 gets the bits of 0.0 and every NaN gets the greatest bits, so a stable radix sort keeps equal zeros
+     *        in their order and puts NaNs after all the other keys in their order, as simdSort does
+     * @param key - integer or floating point key
+     * @return unsigned integer of 32 or 64 bits
+     */
+    template <typename K>
+    auto orderedBits(K key) {
+        static_assert(std::is_arithmetic<K>::value && sizeof(K) <= 8, "radix sort keys are integers or float and double");
+
+        typedef typename std::conditional<sizeof(K) <= 4, uint32_t, uint64_t>::type U;
+
+        const U signBit = (U)1 << (sizeof(U) * 8 - 1);
+
+        if constexpr (std::is_floating_point<K>::value) {
+            static_assert(sizeof(K) == sizeof(U), "radix sort keys are integers or float and double");
+
+            if (key != key)
+                return (U)~(U)0;
+
+            if (key == 0)
+                key = 0;
+
+            U bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+
+            return (bits & signBit) != 0 ? (U)~bits : (U)(bits | signBit);
+        } else if constexpr (std::is_signed<K>::value) {
+            typedef typename std::make_signed<U>::type S;
+
+            return (U)((U)(S)key ^ signBit);
+        } else {
+            return (U)key;
+        }
+    }
+
+    /**
+     * @brief The DefaultKey struct extracts the key of elements sorted without a key function:
+     *        arithmetic elements are keys themselves, Date is sorted by its julian day number
+     */
+    struct DefaultKey {
+        template <typename T>
+        T operator () (const T& element) const {
+            return element;
+        }
+
+        long long operator () (const Date& element) const {
+            return element.date;
+        }
+    };
+
+    /**
+     * @brief isSortable is true if vectors of T are sorted by radixSort without a key function
+     */
+    template <typename T>
+    constexpr bool isSortable() {
+        return std::is_same<T, Date>::value ||
+               (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8);
+    }
+
+}
+
+/**
+ * Worst time complexity - O(d * (n + 256)), where n - size of a vector, d - number of bytes of the key
+ *
+ * @brief radixSort - stable LSD radix sort of a vector by one byte of the key per pass: the counts of all the passes
+ *        are taken in one scan, passes whose bytes are equal for all the elements are skipped, passes go back and forth
+ *        between the vector and one buffer
+ * @param vector - vector to sort
+ * @param key - key(element) returns the integer or floating point key of the element
+ * @param resource - memory resource of the counts and the buffer
+ */
+template <typename T, typename F>
+void radixSort(std::vector<T>& vector, F key, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    using namespace radix_sort;
+
+    typedef decltype(orderedBits(key(std::declval<const T&>()))) U;
+
+    const size_t PASSES = sizeof(U) * 8 / DIGIT_BITS;
+
+    size_t n = vector.size();
+
+    if (n < 2)
+        return;
+
+    std::pmr::vector<std::array<size_t, BUCKETS>> counts(PASSES, resource);
+    for (std::array<size_t, BUCKETS>& count : counts)
+        count.fill(0);
+
+    for (const T& element : vector) {
+        U bits = orderedBits(key(element));
+
+        for (size_t pass = 0; pass < PASSES; pass++)
+            counts[pass][(bits >> (pass * DIGIT_BITS)) & (BUCKETS - 1)]++;
+    }
+
+    std::pmr::vector<T> buffer(resource);
+
+    T* from = vector.data();
+    T* to   = nullptr;
+
+    for (size_t pass = 0; pass < PASSES; pass++) {
+        std::array<size_t, BUCKETS>& count = counts[pass];
+
+        // all the elements have the same byte, the pass would not move anything
+        size_t firstByte = (orderedBits(key(from[0])) >> (pass * DIGIT_BITS)) & (BUCKETS - 1);
+        if (count[firstByte] == n)
+            continue;
+
+        if (buffer.empty()) {
+            buffer.resize(n);
+            to = buffer.data();
+        }
+
+        size_t offset = 0;
+        for (size_t& bucket : count) {
+            size_t size = bucket;
+
+            bucket  = offset;
+            offset += size;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            size_t digit = (orderedBits(key(from[i])) >> (pass * DIGIT_BITS)) & (BUCKETS - 1);
+
+            to[count[digit]++] = std::move(from[i]);
+        }
+
+        std::swap(from, to);
+    }
+
+    if (from != vector.data())
+        std::move(from, from + n, vector.data());
+}
+
+/**
+ * Worst time complexity - O(d * (n + 256)), where n - size of a vector, d - number of bytes of the elements
+ *
+ * @brief radixSort - stable LSD radix sort of a vector of integers, floating point numbers or dates
+ * @param vector - vector to sort
+ */
+template <typename T>
+void radixSort(std::vector<T>& vector) {
+    static_assert(radix_sort::isSortable<T>(), "radixSort without a key function sorts only integers, float, double and Date");
+
+    radixSort(vector, radix_sort::DefaultKey());
+}
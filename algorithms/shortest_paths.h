@@ -0,0 +1,299 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include "fibonacci_heap/fibonacci_heap.h"
+#include "fibonacci_heap/fibonacci_heap_node.h"
+
+/**
+ * @brief The ShortestPaths class runs Dijkstra, bidirectional Dijkstra and A* searches on any graph
+ *        that provides indexCount, indexExist and forEachNeighbor (bidirectional search also needs forEachInNeighbor)
+ *
+ * Every vertex has one FibonacciHeap node owned by the engine, tentative distances are lowered with decreaseKey,
+ * so the heap never holds more than V nodes. The state is kept between queries: a vertex belongs to the current
+ * query only if its stamp equals the number of the query, so a query costs only the vertices it touches and
+ * allocates nothing unless the graph has grown. Weights must not be negative.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     FibonacciHeap
+ * @param   <G> the type of the graph
+ */
+template <typename G>
+class ShortestPaths {
+private:
+    typedef Node<double, int> HeapNode;
+
+    /**
+     * @brief The Search struct keeps the state of the search in one direction
+     */
+    struct Search {
+        std::vector<HeapNode> nodes;    // node of every vertex, its key is distance + heuristic
+        std::vector<double>   distance; // tentative distance of every reached vertex
+        std::vector<int>      parent;   // previous vertex on the path, -1 for the start
+        std::vector<unsigned> reached;  // number of the last query that reached the vertex
+        std::vector<unsigned> settled;  // number of the last query that settled the vertex
+
+        FibonacciHeap<double, int> heap;
+
+        Search() : heap(std::numeric_limits<double>::lowest()) { }
+
+        ~Search() {
+            heap.clear(); // nodes are owned by the vector
+        }
+
+        void resize(int size) {
+            if ((int)nodes.size() >= size)
+                return;
+
+            nodes.resize(size, HeapNode(0, 0));
+            distance.resize(size);
+            parent.resize(size);
+            reached.resize(size, 0);
+            settled.resize(size, 0);
+        }
+
+        bool isReached(int vertex, unsigned query) const {
+            return reached[vertex] == query;
+        }
+
+        bool isSettled(int vertex, unsigned query) const {
+            return settled[vertex] == query;
+        }
+
+        double minKey() {
+            return heap.isEmpty() ? std::numeric_limits<double>::infinity() : heap.findMin()->key;
+        }
+
+        /**
+         * @brief relax lowers the tentative distance of the vertex, returns true if it was lowered
+         */
+        bool relax(int vertex, int from, double newDistance, double heuristic, unsigned query) {
+            if (!isReached(vertex, query)) {
+                reached[vertex]  = query;
+                distance[vertex] = newDistance;
+                parent[vertex]   = from;
+                nodes[vertex]    = HeapNode(newDistance + heuristic, vertex);
+
+                heap.insert(&nodes[vertex]);
+
+                return true;
+            }
+
+            if (isSettled(vertex, query) || !(newDistance < distance[vertex]))
+                return false;
+
+            distance[vertex] = newDistance;
+            parent[vertex]   = from;
+
+            heap.decreaseKey(&nodes[vertex], newDistance + heuristic);
+
+            return true;
+        }
+
+        int settleMin(unsigned query) {
+            int vertex = heap.extractMin()->value;
+
+            settled[vertex] = query;
+
+            return vertex;
+        }
+    };
+
+    const G& graph;
+
+    Search forward;
+    Search backward;
+
+    unsigned query;
+
+    int meetFrom; // last vertex of the forward part of the path found by the bidirectional search
+    int meetTo;   // first vertex of the backward part, -1 if the last query was not bidirectional
+
+    void startQuery() {
+        int size = graph.indexCount();
+
+        forward.resize(size);
+        backward.resize(size);
+
+        forward.heap.clear();
+        backward.heap.clear();
+
+        if (++query == 0) {
+            // the counter has wrapped around, old stamps could match the new queries
+            std::fill(forward.reached.begin(), forward.reached.end(), 0);
+            std::fill(forward.settled.begin(), forward.settled.end(), 0);
+            std::fill(backward.reached.begin(), backward.reached.end(), 0);
+            std::fill(backward.settled.begin(), backward.settled.end(), 0);
+
+            query = 1;
+        }
+
+        meetFrom = meetTo = -1;
+    }
+
+    template <typename H>
+    double search(int start, int target, H heuristic) {
+        startQuery();
+
+        if (!graph.indexExist(start))
+            return INFINITY_DISTANCE;
+
+        forward.relax(start, -1, 0, heuristic(start), query);
+
+        while (!forward.heap.isEmpty()) {
+            int vertex = forward.settleMin(query);
+
+            if (vertex == target)
+                return forward.distance[vertex];
+
+            graph.forEachNeighbor(vertex, [&](int to, const auto& weight) {
+                forward.relax(to, vertex, forward.distance[vertex] + weight, heuristic(to), query);
+            });
+        }
+
+        return INFINITY_DISTANCE;
+    }
+
+public:
+    static constexpr double INFINITY_DISTANCE = std::numeric_limits<double>::infinity();
+
+    explicit ShortestPaths(const G& graph) : graph(graph), query(0), meetFrom(-1), meetTo(-1) { }
+
+    ShortestPaths(const ShortestPaths&)            = delete;
+    ShortestPaths& operator=(const ShortestPaths&) = delete;
+
+    /**
+     * Amortized time complexity - O(E + V*log(V))
+     *
+     * @brief dijkstra finds distances from the source to all the vertices, they are read with distance and path
+     * @param start - index of the source
+     */
+    void dijkstra(int start) {
+        search(start, -1, [](int) { return 0.0; });
+    }
+
+    /**
+     * Amortized time complexity - O(E + V*log(V)), the search stops as soon as the target is settled
+     *
+     * @brief dijkstra finds the distance between two vertices
+     * @param start - index of the source
+     * @param target - index of the target
+     * @return the distance, INFINITY_DISTANCE if the target is unreachable
+     */
+    double dijkstra(int start, int target) {
+        return search(start, target, [](int) { return 0.0; });
+    }
+
+    /**
+     * Amortized time complexity - O(E + V*log(V)), usually settles much fewer vertices than dijkstra
+     *
+     * @brief aStar finds the distance between two vertices directing the search by the heuristic
+     * @param start - index of the source
+     * @param target - index of the target
+     * @param heuristic - heuristic(index) is a lower bound of the distance from the vertex to the target,
+     *                    it must be consistent: heuristic(u) <= weight(u, v) + heuristic(v) for every edge
+     * @return the distance, INFINITY_DISTANCE if the target is unreachable
+     */
+    template <typename H>
+    double aStar(int start, int target, H heuristic) {
+        return search(start, target, heuristic);
+    }
+
+    /**
+     * Amortized time complexity - O(E + V*log(V)), usually settles much fewer vertices than dijkstra
+     *
+     * @brief bidirectional finds the distance between two vertices by searching forward from the source
+     *        and backward from the target until the searches meet
+     * @param start - index of the source
+     * @param target - index of the target
+     * @return the distance, INFINITY_DISTANCE if the target is unreachable
+     */
+    double bidirectional(int start, int target) {
+        startQuery();
+
+        if (!graph.indexExist(start) || !graph.indexExist(target))
+            return INFINITY_DISTANCE;
+
+        if (start == target) {
+            forward.relax(start, -1, 0, 0, query);
+            return 0;
+        }
+
+        double best = INFINITY_DISTANCE;
+
+        forward.relax(start, -1, 0, 0, query);
+        backward.relax(target, -1, 0, 0, query);
+
+        // the searches may stop when no path through unsettled vertices can be shorter than the best one
+        while (forward.minKey() + backward.minKey() < best) {
+            bool isForward = forward.minKey() <= backward.minKey();
+
+            Search& current  = isForward ? forward : backward;
+            Search& opposite = isForward ? backward : forward;
+
+            int vertex = current.settleMin(query);
+
+            auto relaxEdge = [&](int to, const auto& weight) {
+                double distance = current.distance[vertex] + weight;
+
+                current.relax(to, vertex, distance, 0, query);
+
+                if (opposite.isReached(to, query) && distance + opposite.distance[to] < best) {
+                    best     = distance + opposite.distance[to];
+                    meetFrom = isForward ? vertex : to;
+                    meetTo   = isForward ? to : vertex;
+                }
+            };
+
+            if (isForward)
+                graph.forEachNeighbor(vertex, relaxEdge);
+            else
+                graph.forEachInNeighbor(vertex, relaxEdge);
+        }
+
+        return best;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief distance returns the distance from the source of the last query to the vertex found by that query,
+     *        for point-to-point queries only vertices settled before the search stopped have exact distances
+     * @param vertex - index of the vertex
+     * @return the distance, INFINITY_DISTANCE if the vertex was not reached
+     */
+    double distance(int vertex) const {
+        return forward.isReached(vertex, query) ? forward.distance[vertex] : INFINITY_DISTANCE;
+    }
+
+    /**
+     * Worst case time complexity - O(length of the path)
+     *
+     * @brief path returns the indexes of vertices on the shortest path from the source of the last query
+     *        to the target, for point-to-point queries the target has to be the target of the query
+     * @param target - index of the target
+     * @return the path from the source to the target, empty if the target was not reached
+     */
+    std::vector<int> path(int target) const {
+        std::vector<int> result;
+
+        int last = meetTo == -1 ? target : meetFrom;
+
+        if (!forward.isReached(last, query))
+            return result;
+
+        for (int vertex = last; vertex != -1; vertex = forward.parent[vertex])
+            result.push_back(vertex);
+
+        std::reverse(result.begin(), result.end());
+
+        if (meetTo != -1)
+            for (int vertex = meetTo; vertex != -1; vertex = backward.parent[vertex])
+                result.push_back(vertex);
+
+        return result;
+    }
+};
@@ -0,0 +1,456 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "algorithms/date.h"
+
+/**
+ * Vectorized sorting of primitive keys: every register of 32 bytes is sorted by a bitonic sorting network,
+ * then sorted runs are merged by a bitonic merge of two registers that streams through both runs.
+ * Compare-exchanges are min/max of whole registers, so the sort has no data-dependent branches
+ * except the choice of the run to load the next register from.
+ *
+ * With AVX2 (-mavx2 or -march=native) the registers are __m256/__m256d/__m256i, otherwise the same networks
+ * run on arrays of 32 bytes and are left to the compiler.
+ */
+namespace simd_sort {
+
+    enum class KeyKind { None, Int32, Int64, Float32, Float64 };
+
+    /**
+     * @brief The SortKey struct tells whether elements of type T are sorted by vectorized networks and how
+     *        to reach their keys: arithmetic elements are keys themselves, Date is sorted by its julian day number
+     */
+    template <typename T, typename = void>
+    struct SortKey {
+        static const KeyKind kind = KeyKind::None;
+    };
+
+    template <typename T>
+    struct SortKey<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+        typedef T Key;
+
+        static const KeyKind kind =
+            std::is_same<T, float>::value  ? KeyKind::Float32 :
+            std::is_same<T, double>::value ? KeyKind::Float64 :
+            std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 4 ? KeyKind::Int32 :
+            std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 8 ? KeyKind::Int64 :
+            KeyKind::None;
+
+        static Key* keys(T* elements) {
+            return elements;
+        }
+    };
+
+    template <>
+    struct SortKey<Date> {
+        typedef long long Key;
+
+        static const KeyKind kind = KeyKind::Int64;
+
+        static Key* keys(Date* elements) {
+            static_assert(sizeof(Date) == sizeof(long long) && std::is_standard_layout<Date>::value,
+                          "Date has to consist of its julian day number only");
+
+            return reinterpret_cast<Key*>(elements); // Date and its only member are pointer-interconvertible
+        }
+    };
+
+    /**
+     * @brief isSupported is true if vectors of T are sorted by the vectorized networks
+     */
+    template <typename T>
+    constexpr bool isSupported() {
+        return SortKey<T>::kind != KeyKind::None;
+    }
+
+    /**
+     * @brief isVectorized is true if vectors of T are sorted in AVX2 registers, the portable networks
+     *        are slower than a scalar sort and are only a fallback for simdSort itself
+     */
+    template <typename T>
+    constexpr bool isVectorized() {
+#ifdef __AVX2__
+        return isSupported<T>();
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief maxMask returns the lanes that keep the maximum in the compare-exchange of lanes i and i ^ d
+     *        of a bitonic network, blocks of "block" lanes are sorted ascending if (i & block) == 0
+     */
+    constexpr unsigned maxMask(size_t count, size_t d, size_t block) {
+        unsigned mask = 0;
+
+        for (size_t i = 0; i < count; i++)
+            if (((i & d) != 0) != ((i & block) != 0))
+                mask |= 1u << i;
+
+        return mask;
+    }
+
+    /**
+     * @brief The Lanes struct is a portable register of 32 bytes
+     */
+    template <typename K, KeyKind kind = SortKey<K>::kind>
+    struct Lanes {
+        static const size_t COUNT = 32 / sizeof(K);
+
+        struct Vector {
+            K lane[COUNT];
+        };
+
+        static Vector load(const K* from) {
+            Vector x;
+            std::copy(from, from + COUNT, x.lane);
+            return x;
+        }
+
+        static void store(K* to, const Vector& x) {
+            std::copy(x.lane, x.lane + COUNT, to);
+        }
+
+        static Vector min(const Vector& a, const Vector& b) {
+            Vector x;
+            for (size_t i = 0; i < COUNT; i++)
+                x.lane[i] = b.lane[i] < a.lane[i] ? b.lane[i] : a.lane[i];
+            return x;
+        }
+
+        static Vector max(const Vector& a, const Vector& b) {
+            Vector x;
+            for (size_t i = 0; i < COUNT; i++)
+                x.lane[i] = b.lane[i] < a.lane[i] ? a.lane[i] : b.lane[i];
+            return x;
+        }
+
+        static Vector reverse(const Vector& a) {
+            Vector x;
+            for (size_t i = 0; i < COUNT; i++)
+                x.lane[i] = a.lane[COUNT - 1 - i];
+            return x;
+        }
+
+        template <size_t D>
+        static Vector permuteXor(const Vector& a) {
+            Vector x;
+            for (size_t i = 0; i < COUNT; i++)
+                x.lane[i] = a.lane[i ^ D];
+            return x;
+        }
+
+        template <unsigned MASK>
+        static Vector blend(const Vector& low, const Vector& high) {
+            Vector x;
+            for (size_t i = 0; i < COUNT; i++)
+                x.lane[i] = (MASK >> i) & 1 ? high.lane[i] : low.lane[i];
+            return x;
+        }
+    };
+
+#ifdef __AVX2__
+    template <typename K>
+    struct Lanes<K, KeyKind::Int32> {
+        static const size_t COUNT = 8;
+
+        typedef __m256i Vector;
+
+        static Vector load(const K* from)                    { return _mm256_loadu_si256((const __m256i*)from); }
+        static void   store(K* to, Vector x)                 { _mm256_storeu_si256((__m256i*)to, x); }
+        static Vector min(Vector a, Vector b)                { return _mm256_min_epi32(a, b); }
+        static Vector max(Vector a, Vector b)                { return _mm256_max_epi32(a, b); }
+        static Vector reverse(Vector a)                      { return _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+
+        template <size_t D>
+        static Vector permuteXor(Vector a) {
+            if (D == 1) return _mm256_shuffle_epi32(a, _MM_SHUFFLE(2, 3, 0, 1));
+            if (D == 2) return _mm256_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm256_permute2x128_si256(a, a, 1);
+        }
+
+        template <unsigned MASK>
+        static Vector blend(Vector low, Vector high) { return _mm256_blend_epi32(low, high, MASK); }
+    };
+
+    template <typename K>
+    struct Lanes<K, KeyKind::Float32> {
+        static const size_t COUNT = 8;
+
+        typedef __m256 Vector;
+
+        static Vector load(const K* from)                    { return _mm256_loadu_ps(from); }
+        static void   store(K* to, Vector x)                 { _mm256_storeu_ps(to, x); }
+        static Vector min(Vector a, Vector b)                { return _mm256_min_ps(a, b); }
+        static Vector max(Vector a, Vector b)                { return _mm256_max_ps(a, b); }
+        static Vector reverse(Vector a)                      { return _mm256_permutevar8x32_ps(a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+
+        template <size_t D>
+        static Vector permuteXor(Vector a) {
+            if (D == 1) return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+            if (D == 2) return _mm256_permute_ps(a, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm256_permute2f128_ps(a, a, 1);
+        }
+
+        template <unsigned MASK>
+        static Vector blend(Vector low, Vector high) { return _mm256_blend_ps(low, high, MASK); }
+    };
+
+    template <typename K>
+    struct Lanes<K, KeyKind::Int64> {
+        static const size_t COUNT = 4;
+
+        typedef __m256i Vector;
+
+        static Vector load(const K* from)                    { return _mm256_loadu_si256((const __m256i*)from); }
+        static void   store(K* to, Vector x)                 { _mm256_storeu_si256((__m256i*)to, x); }
+        static Vector min(Vector a, Vector b)                { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+        static Vector max(Vector a, Vector b)                { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+        static Vector reverse(Vector a)                      { return _mm256_permute4x64_epi64(a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+        template <size_t D>
+        static Vector permuteXor(Vector a) {
+            if (D == 1) return _mm256_permute4x64_epi64(a, _MM_SHUFFLE(2, 3, 0, 1));
+            return _mm256_permute4x64_epi64(a, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+
+        // every 64-bit lane is two 32-bit lanes of the blend
+        static constexpr int wideMask(unsigned mask) {
+            return (mask & 1 ? 0x03 : 0) | (mask & 2 ? 0x0C : 0) | (mask & 4 ? 0x30 : 0) | (mask & 8 ? 0xC0 : 0);
+        }
+
+        template <unsigned MASK>
+        static Vector blend(Vector low, Vector high) { return _mm256_blend_epi32(low, high, wideMask(MASK)); }
+    };
+
+    template <typename K>
+    struct Lanes<K, KeyKind::Float64> {
+        static const size_t COUNT = 4;
+
+        typedef __m256d Vector;
+
+        static Vector load(const K* from)                    { return _mm256_loadu_pd(from); }
+        static void   store(K* to, Vector x)                 { _mm256_storeu_pd(to, x); }
+        static Vector min(Vector a, Vector b)                { return _mm256_min_pd(a, b); }
+        static Vector max(Vector a, Vector b)                { return _mm256_max_pd(a, b); }
+        static Vector reverse(Vector a)                      { return _mm256_permute4x64_pd(a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+        template <size_t D>
+        static Vector permuteXor(Vector a) {
+            if (D == 1) return _mm256_permute4x64_pd(a, _MM_SHUFFLE(2, 3, 0, 1));
+            return _mm256_permute4x64_pd(a, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+
+        template <unsigned MASK>
+        static Vector blend(Vector low, Vector high) { return _mm256_blend_pd(low, high, MASK); }
+    };
+#endif
+
+    /**
+     * @brief The BitonicSteps struct applies compare-exchanges at distances D, D / 2, ..., 1
+     *        inside blocks of BLOCK lanes of one register
+     */
+    template <typename L, size_t BLOCK, size_t D>
+    struct BitonicSteps {
+        static typename L::Vector apply(typename L::Vector x) {
+            typename L::Vector partner = L::template permuteXor<D>(x);
+
+            x = L::template blend<maxMask(L::COUNT, D, BLOCK)>(L::min(x, partner), L::max(x, partner));
+
+            return BitonicSteps<L, BLOCK, D / 2>::apply(x);
+        }
+    };
+
+    template <typename L, size_t BLOCK>
+    struct BitonicSteps<L, BLOCK, 0> {
+        static typename L::Vector apply(typename L::Vector x) {
+            return x;
+        }
+    };
+
+    /**
+     * @brief The BitonicSort struct sorts blocks of BLOCK lanes of one register, alternately ascending and descending
+     */
+    template <typename L, size_t BLOCK>
+    struct BitonicSort {
+        static typename L::Vector apply(typename L::Vector x) {
+            return BitonicSteps<L, BLOCK, BLOCK / 2>::apply(BitonicSort<L, BLOCK / 2>::apply(x));
+        }
+    };
+
+    template <typename L>
+    struct BitonicSort<L, 1> {
+        static typename L::Vector apply(typename L::Vector x) {
+            return x;
+        }
+    };
+
+    /**
+     * Worst case time complexity - O(log(COUNT))
+     *
+     * @brief mergeRegisters merges two sorted registers: low gets the smaller half, high gets the bigger one
+     */
+    template <typename L>
+    void mergeRegisters(typename L::Vector& low, typename L::Vector& high) {
+        typename L::Vector reversed = L::reverse(high);
+
+        typename L::Vector a = L::min(low, reversed);
+        typename L::Vector b = L::max(low, reversed);
+
+        // both halves of the bitonic sequence are bitonic themselves
+        low  = BitonicSteps<L, L::COUNT, L::COUNT / 2>::apply(a);
+        high = BitonicSteps<L, L::COUNT, L::COUNT / 2>::apply(b);
+    }
+
+    /**
+     * Worst case time complexity - O(n1 + n2)
+     *
+     * @brief mergeRuns merges sorted runs a[0, n1) and b[0, n2) into "to", both lengths are multiples of COUNT:
+     *        the register with the bigger half of the last merge is merged with the next register of the run
+     *        whose next key is smaller
+     */
+    template <typename L, typename K>
+    void mergeRuns(const K* a, size_t n1, const K* b, size_t n2, K* to) {
+        if (n2 == 0) {
+            std::copy(a, a + n1, to);
+            return;
+        }
+
+        typename L::Vector low  = L::load(a);
+        typename L::Vector high = L::load(b);
+
+        size_t i = L::COUNT, j = L::COUNT;
+
+        mergeRegisters<L>(low, high);
+        L::store(to, low);
+        to += L::COUNT;
+
+        while (i < n1 || j < n2) {
+            if (j == n2 || (i < n1 && !(b[j] < a[i]))) {
+                low = L::load(a + i);
+                i  += L::COUNT;
+            } else {
+                low = L::load(b + j);
+                j  += L::COUNT;
+            }
+
+            mergeRegisters<L>(low, high);
+            L::store(to, low);
+            to += L::COUNT;
+        }
+
+        L::store(to, high);
+    }
+
+    /**
+     * Worst time complexity - O(n * log(n))
+     *
+     * @brief sortKeys sorts n keys: registers are sorted by the bitonic network, then runs are merged pairwise,
+     *        levels go back and forth between the keys and one buffer, the tail is padded with the biggest key
+     */
+    template <typename K>
+    void sortKeys(K* keys, size_t n, std::pmr::memory_resource* resource) {
+        typedef Lanes<K> L;
+
+        if (n < 2)
+            return;
+
+        const K biggest = std::numeric_limits<K>::has_infinity ? std::numeric_limits<K>::infinity()
+                                                               : std::numeric_limits<K>::max();
+
+        size_t padded = (n + L::COUNT - 1) / L::COUNT * L::COUNT;
+
+        std::pmr::vector<K> storage(resource);
+        K*                  from = keys;
+
+        if (padded != n) {
+            storage.assign(keys, keys + n);
+            storage.resize(padded, biggest);
+            from = storage.data();
+        }
+
+        for (size_t i = 0; i < padded; i += L::COUNT)
+            L::store(from + i, BitonicSort<L, L::COUNT>::apply(L::load(from + i)));
+
+        std::pmr::vector<K> buffer(padded, resource);
+        K*                  to = buffer.data();
+
+        for (size_t run = L::COUNT; run < padded; run *= 2) {
+            for (size_t left = 0; left < padded; left += 2 * run) {
+                size_t mid   = std::min(left + run, padded);
+                size_t right = std::min(left + 2 * run, padded);
+
+                mergeRuns<L>(from + left, mid - left, from + mid, right - mid, to + left);
+            }
+
+            std::swap(from, to);
+        }
+
+        if (from != keys)
+            std::copy(from, from + n, keys);
+    }
+
+    /**
+     * Worst time complexity - O(n * log(n))
+     *
+     * @brief sortFloatingKeys sorts n floating point keys as a stable comparison sort does: min/max of the network
+     *        drop NaNs, so NaNs are moved to the end in their original order before the network runs,
+     *        and the network cannot tell -0.0 from 0.0, so the zeros are put back in their original order after it
+     */
+    template <typename K>
+    void sortFloatingKeys(K* keys, size_t n, std::pmr::memory_resource* resource) {
+        std::pmr::vector<K> nans(resource);
+        std::pmr::vector<K> zeros(resource);
+
+        size_t count = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            if (keys[i] != keys[i]) {
+                nans.push_back(keys[i]);
+                continue;
+            }
+
+            if (keys[i] == 0)
+                zeros.push_back(keys[i]);
+
+            keys[count++] = keys[i];
+        }
+
+        std::copy(nans.begin(), nans.end(), keys + count);
+
+        sortKeys(keys, count, resource);
+
+        std::copy(zeros.begin(), zeros.end(), std::lower_bound(keys, keys + count, K(0)));
+    }
+
+}
+
+/**
+ * Worst time complexity - O(n * log(n)), where n - size of a vector
+ *
+ * @brief simdSort - sorts a vector of int, long long, float, double or Date by vectorized sorting networks
+ *        and bitonic merges, the result is the one of a stable sort (notice - NaNs are placed after all the other
+ *        keys in their original order)
+ * @param vector - vector to sort
+ * @param resource - memory resource of the buffers
+ */
+template <typename T>
+void simdSort(std::vector<T>& vector, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    static_assert(simd_sort::isSupported<T>(), "simdSort sorts only signed 32/64-bit integers, float, double and Date");
+
+    if constexpr (std::is_floating_point<T>::value)
+        simd_sort::sortFloatingKeys(vector.data(), vector.size(), resource);
+    else
+        simd_sort::sortKeys(simd_sort::SortKey<T>::keys(vector.data()), vector.size(), resource);
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+/**
+ * @brief The ThreadPool class implements a fixed set of worker threads with work stealing
+ *
+ * Every worker owns a deque of tasks. A task submitted by a worker goes to its own deque, a task submitted
+ * from outside goes to the deques in turn. A worker takes tasks from the front of its own deque and,
+ * when it is empty, steals from the back of the others, so uneven tasks are balanced between workers.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ */
+class ThreadPool {
+private:
+    /**
+     * @brief The Queue struct is the deque of tasks of one worker
+     */
+    struct Queue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex                        mutex;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread>            workers;
+
+    std::mutex              stateMutex;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+
+    size_t queued;  // submitted tasks no worker has taken yet
+    size_t pending; // submitted tasks that have not finished yet
+    bool   stopping;
+
+    std::atomic<size_t> nextQueue;
+
+    static ThreadPool*& currentPool() {
+        static thread_local ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& currentWorker() {
+        static thread_local size_t worker = 0;
+        return worker;
+    }
+
+    bool take(size_t worker, std::function<void()>& task) {
+        for (size_t i = 0; i < queues.size(); i++) {
+            Queue& queue = *queues[(worker + i) % queues.size()];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+
+            if (queue.tasks.empty())
+                continue;
+
+            if (i == 0) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            } else {
+                task = std::move(queue.tasks.back()); // stealing
+                queue.tasks.pop_back();
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void run(size_t worker) {
+        currentPool()   = this;
+        currentWorker() = worker;
+
+        std::function<void()> task;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(stateMutex);
+
+                wakeUp.wait(lock, [&]() { return stopping || queued > 0; });
+
+                if (queued == 0)
+                    return; // stopping and nothing left
+
+                queued--;
+            }
+
+            // the task is reserved above, so some deque certainly has it
+            while (!take(worker, task)) { }
+
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(stateMutex);
+
+            if (--pending == 0)
+                finished.notify_all();
+        }
+    }
+
+public:
+    /**
+     * Worst case time complexity - O(threads)
+     *
+     * @brief ThreadPool starts the worker threads
+     * @param threads - number of workers, 0 means std::thread::hardware_concurrency()
+     */
+    explicit ThreadPool(unsigned threads = 0) : queued(0), pending(0), stopping(false), nextQueue(0) {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (unsigned i = 0; i < threads; i++)
+            queues.emplace_back(new Queue());
+
+        for (unsigned i = 0; i < threads; i++)
+            workers.emplace_back(&ThreadPool::run, this, (size_t)i);
+    }
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief ~ThreadPool finishes all the submitted tasks and stops the workers
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+
+        wakeUp.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief submit schedules the task on one of the workers
+     * @param task - task to run
+     */
+    void submit(std::function<void()> task) {
+        size_t queue = currentPool() == this ? currentWorker() : nextQueue++ % queues.size();
+
+        {
+            std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+            queues[queue]->tasks.push_back(std::move(task));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            queued++;
+            pending++;
+        }
+
+        wakeUp.notify_one();
+    }
+
+    /**
+     * @brief wait blocks until all the submitted tasks have finished (notice - must not be called from a task)
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(stateMutex);
+
+        finished.wait(lock, [&]() { return pending == 0; });
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief size returns the number of workers
+     * @return the number of workers
+     */
+    unsigned size() const {
+        return (unsigned)workers.size();
+    }
+};
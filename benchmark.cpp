@@ -0,0 +1,918 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <queue>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <memory_resource>
+
+#include "btree/btree.h"
+#include "fibonacci_heap/fibonacci_heap.h"
+#include "fibonacci_heap/fibonacci_heap_node.h"
+#include "graph/graph_on_adjacency_matrix.h"
+#include "graph/graph_on_adjacency_list.h"
+#include "graph/graph_file.h"
+#include "graph/edge_list_loader.h"
+#include "graph/concurrent_adjacency_matrix.h"
+#include "algorithms/prim.h"
+#include "algorithms/merge_sort.h"
+#include "algorithms/adaptive_merge_sort.h"
+#include "algorithms/parallel_merge_sort.h"
+#include "algorithms/external_merge_sort.h"
+#include "algorithms/indirect_sort.h"
+#include "algorithms/radix_sort.h"
+#include "algorithms/simd_sort.h"
+#include "algorithms/date.h"
+#include "algorithms/date_parser.h"
+
+/**
+ * Benchmarks of all the data structures and algorithms against the standard library.
+ *
+ * Every row of the output is one measurement in CSV:
+ *     group,variant,n,repeats,best_seconds,median_seconds,ns_per_element
+ * rows of one group at one n do the same work and are comparable, (group, variant, n) identifies a row between runs.
+ * Progress goes to stderr, so stdout can be redirected into a file and compared with the previous one.
+ *
+ * Usage: benchmark [--min-scale N] [--max-scale N] [--repeats R] [--filter TEXT] [--threads T] [--tmp DIRECTORY]
+ * scales go from --min-scale (1e3) to --max-scale (1e6) by powers of 10, --max-scale 100000000 runs the full sweep.
+ */
+namespace {
+
+    struct Options {
+        size_t      minScale  = 1000;
+        size_t      maxScale  = 1000000;
+        int         repeats   = 3;
+        unsigned    threads   = 0;
+        std::string filter;
+        std::string directory = "/tmp";
+    };
+
+    Options options;
+
+    volatile uint64_t sink = 0; // results are added here so that the measured work is not optimized away
+
+    typedef std::chrono::steady_clock Clock;
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    bool isSelected(const std::string& group, const std::string& variant) {
+        return options.filter.empty() || (group + "," + variant).find(options.filter) != std::string::npos;
+    }
+
+    void printRow(const std::string& group, const std::string& variant, size_t n, std::vector<double> seconds) {
+        std::sort(seconds.begin(), seconds.end());
+
+        double best   = seconds.front();
+        double median = seconds[seconds.size() / 2];
+
+        std::printf("%s,%s,%zu,%zu,%.9f,%.9f,%.3f\n", group.c_str(), variant.c_str(), n, seconds.size(), best, median,
+                    best * 1e9 / (double)n);
+        std::fflush(stdout);
+
+        std::fprintf(stderr, "%-28s %-34s n=%-10zu best %.6fs  %.2f ns/element\n", group.c_str(), variant.c_str(), n, best,
+                     best * 1e9 / (double)n);
+    }
+
+    /**
+     * @brief measure runs prepare() and then body() options.repeats times, only body() is timed,
+     *        n is the number of elements the body works on
+     */
+    template <typename P, typename B>
+    void measure(const std::string& group, const std::string& variant, size_t n, P prepare, B body) {
+        if (!isSelected(group, variant))
+            return;
+
+        std::vector<double> seconds;
+
+        for (int repeat = 0; repeat < options.repeats; repeat++) {
+            prepare();
+
+            Clock::time_point start = Clock::now();
+            body();
+            seconds.push_back(secondsSince(start));
+        }
+
+        printRow(group, variant, n, seconds);
+    }
+
+    template <typename B>
+    void measure(const std::string& group, const std::string& variant, size_t n, B body) {
+        measure(group, variant, n, []() { }, body);
+    }
+
+    std::vector<int> randomKeys(size_t n, uint32_t seed) {
+        std::mt19937     random(seed);
+        std::vector<int> keys(n);
+
+        for (int& key : keys)
+            key = (int)(random() & INT_MAX);
+
+        return keys;
+    }
+
+    /**
+     * @brief threadCounts returns 1, 2, 4, ... up to --threads (or the number of cores), the maximum itself included
+     */
+    std::vector<unsigned> threadCounts() {
+        unsigned maximum = options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+        std::vector<unsigned> counts;
+        for (unsigned threads = 1; threads < maximum; threads *= 2)
+            counts.push_back(threads);
+        counts.push_back(maximum);
+
+        return counts;
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    void benchmarkOrderedMaps(size_t n) {
+        std::vector<int>  keys    = randomKeys(n, 1);
+        std::vector<int>  queries = randomKeys(n, 2);
+        std::vector<int*> values(n);
+
+        for (size_t i = 0; i < n; i++)
+            values[i] = &keys[i];
+
+        for (size_t i = 0; i < n; i += 2)
+            queries[i] = keys[(size_t)queries[i] % n]; // half of the lookups find their keys
+
+        size_t    ranges = n / 100 + 1; // every range holds about 100 keys
+        long long width  = (long long)INT_MAX / (long long)n * 100;
+
+        std::unique_ptr<BTree<int, int*>> tree;
+        std::map<int, int*>               map;
+
+        measure("ordered map add", "BTree", n, [&]() { tree = std::make_unique<BTree<int, int*>>(32); }, [&]() {
+            for (size_t i = 0; i < n; i++)
+                tree->add(keys[i], values[i]);
+        });
+
+        measure("ordered map add", "std::map", n, [&]() { map.clear(); }, [&]() {
+            for (size_t i = 0; i < n; i++)
+                map.emplace(keys[i], values[i]);
+        });
+
+        if (map.empty())
+            for (size_t i = 0; i < n; i++)
+                map.emplace(keys[i], values[i]);
+
+        if (tree == nullptr) {
+            tree = std::make_unique<BTree<int, int*>>(32);
+
+            for (size_t i = 0; i < n; i++)
+                tree->add(keys[i], values[i]);
+        }
+
+        measure("ordered map lookup", "BTree", n, [&]() {
+            for (int query : queries)
+                sink += tree->lookup(query) != nullptr;
+        });
+
+        measure("ordered map lookup", "std::map", n, [&]() {
+            for (int query : queries)
+                sink += map.find(query) != map.end();
+        });
+
+        measure("ordered map lookupRange", "BTree", ranges, [&]() {
+            for (size_t i = 0; i < ranges; i++)
+                sink += tree->lookupRange(queries[i], (int)std::min<long long>(INT_MAX, queries[i] + width)).size();
+        });
+
+        measure("ordered map lookupRange", "std::map", ranges, [&]() {
+            for (size_t i = 0; i < ranges; i++) {
+                std::vector<int*> range;
+                auto              last = map.upper_bound((int)std::min<long long>(INT_MAX, queries[i] + width));
+
+                for (auto it = map.lower_bound(queries[i]); it != last; ++it)
+                    range.push_back(it->second);
+
+                sink += range.size();
+            }
+        });
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    void benchmarkPriorityQueues(size_t n) {
+        typedef Node<long long, int>                                             HeapNode;
+        typedef std::pair<long long, int>                                        Item;
+        typedef std::priority_queue<Item, std::vector<Item>, std::greater<Item>> StdQueue;
+
+        std::vector<int> keys = randomKeys(n, 3);
+
+        std::vector<HeapNode>         nodes;
+        FibonacciHeap<long long, int> heap(LLONG_MIN);
+        StdQueue                      queue;
+
+        auto fillNodes = [&]() {
+            heap.clear();
+            nodes.assign(n, HeapNode(0, 0));
+            for (size_t i = 0; i < n; i++)
+                nodes[i] = HeapNode(keys[i], (int)i);
+        };
+
+        auto fillHeap = [&]() {
+            fillNodes();
+            for (HeapNode& node : nodes)
+                heap.insert(&node);
+        };
+
+        auto fillQueue = [&]() {
+            queue = StdQueue();
+            for (size_t i = 0; i < n; i++)
+                queue.push({ keys[i], (int)i });
+        };
+
+        measure("priority queue insert", "FibonacciHeap", n, fillNodes, [&]() {
+            for (HeapNode& node : nodes)
+                heap.insert(&node);
+        });
+
+        measure("priority queue insert", "std::priority_queue", n, [&]() { queue = StdQueue(); }, [&]() {
+            for (size_t i = 0; i < n; i++)
+                queue.push({ keys[i], (int)i });
+        });
+
+        measure("priority queue extractMin", "FibonacciHeap", n, fillHeap, [&]() {
+            while (!heap.isEmpty())
+                sink += heap.extractMin()->value;
+        });
+
+        measure("priority queue extractMin", "std::priority_queue", n, fillQueue, [&]() {
+            while (!queue.empty()) {
+                sink += queue.top().second;
+                queue.pop();
+            }
+        });
+
+        // every element is decreased once and then all of them are extracted, the standard queue has no
+        // decreaseKey, so it pushes a second item and skips stale ones on extraction as lazy Dijkstra does
+        measure("priority queue decreaseKey", "FibonacciHeap", n, fillHeap, [&]() {
+            for (HeapNode& node : nodes)
+                heap.decreaseKey(&node, node.key - (node.key >> 1) - 1);
+
+            while (!heap.isEmpty())
+                sink += heap.extractMin()->value;
+        });
+
+        measure("priority queue decreaseKey", "std::priority_queue", n, fillQueue, [&]() {
+            std::vector<long long> current(keys.begin(), keys.end());
+
+            for (size_t i = 0; i < n; i++) {
+                current[i] -= (current[i] >> 1) + 1;
+                queue.push({ current[i], (int)i });
+            }
+
+            while (!queue.empty()) {
+                Item item = queue.top();
+                queue.pop();
+
+                if (item.first == current[item.second])
+                    sink += item.second;
+            }
+        });
+
+        heap.clear();
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    const int MAXIMUM_GRAPH_VERTICES = 8192; // the matrix of 8192 vertices takes 256 MB
+
+    int graphVertices(size_t edges) {
+        return (int)std::min<double>(MAXIMUM_GRAPH_VERTICES, std::max(16.0, 2 * std::sqrt((double)edges)));
+    }
+
+    std::vector<std::tuple<int, int, int>> randomEdges(size_t n, int vertices, uint32_t seed) {
+        std::mt19937                           random(seed);
+        std::vector<std::tuple<int, int, int>> edges(n);
+
+        for (auto& edge : edges)
+            edge = std::make_tuple((int)(random() % vertices), (int)(random() % vertices), 1 + (int)(random() % 1000000));
+
+        return edges;
+    }
+
+    template <typename G>
+    void benchmarkGraph(const std::string& variant, size_t n, int vertices, const std::vector<std::tuple<int, int, int>>& edges) {
+        std::vector<int> vertexList(vertices);
+        for (int i = 0; i < vertices; i++)
+            vertexList[i] = i;
+
+        std::unique_ptr<G> graph;
+
+        auto emptyGraph = [&]() {
+            graph.reset(new G());
+            graph->insertVertices(vertexList);
+        };
+
+        auto fullGraph = [&]() {
+            emptyGraph();
+            graph->insertEdges(edges);
+        };
+
+        measure("graph insertEdge", variant, n, emptyGraph, [&]() {
+            for (const auto& edge : edges)
+                graph->insertEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+        });
+
+        measure("graph insertEdges", variant, n, emptyGraph, [&]() { graph->insertEdges(edges); });
+
+        measure("graph areAdjacent", variant, n, fullGraph, [&]() {
+            for (const auto& edge : edges)
+                sink += graph->areAdjacent(std::get<1>(edge), std::get<0>(edge));
+        });
+
+        measure("graph forEachNeighbor", variant, n, fullGraph, [&]() {
+            for (int index = 0; index < graph->indexCount(); index++)
+                graph->forEachNeighbor(index, [&](int to, int weight) { sink += to + weight; });
+        });
+
+        measure("graph removeEdge", variant, n, fullGraph, [&]() {
+            for (const auto& edge : edges)
+                graph->removeEdge(std::get<0>(edge), std::get<1>(edge));
+        });
+
+        measure("graph degree", variant, n, fullGraph, [&]() {
+            for (const auto& edge : edges)
+                sink += graph->degree(std::get<0>(edge));
+        });
+
+        // every vertex is removed with all its edges, n is the number of edges removed with them
+        measure("graph removeVertex", variant, n, fullGraph, [&]() {
+            for (int vertex : vertexList)
+                graph->removeVertex(vertex);
+        });
+    }
+
+    /**
+     * @brief benchmarkVertexGrowth measures insertion of vertices one by one into a growing matrix
+     *        and into a matrix reserved in advance, and the reserve call itself
+     */
+    void benchmarkVertexGrowth(size_t n) {
+        int vertices = (int)std::min<size_t>(n, MAXIMUM_GRAPH_VERTICES);
+
+        std::unique_ptr<AdjacencyMatrix<int, int>> matrix;
+        std::unique_ptr<AdjacencyList<int, int>>   list;
+
+        auto emptyMatrix = [&]() { matrix.reset(new AdjacencyMatrix<int, int>()); };
+
+        measure("graph insertVertex", "AdjacencyMatrix growing", vertices, emptyMatrix, [&]() {
+            for (int vertex = 0; vertex < vertices; vertex++)
+                matrix->insertVertex(vertex);
+        });
+
+        measure("graph insertVertex", "AdjacencyMatrix reserve + insertVertex", vertices, emptyMatrix, [&]() {
+            matrix->reserve(vertices);
+
+            for (int vertex = 0; vertex < vertices; vertex++)
+                matrix->insertVertex(vertex);
+        });
+
+        measure("graph insertVertex", "AdjacencyList", vertices, [&]() { list.reset(new AdjacencyList<int, int>()); }, [&]() {
+            for (int vertex = 0; vertex < vertices; vertex++)
+                list->insertVertex(vertex);
+        });
+
+        measure("graph reserve", "AdjacencyMatrix", vertices, emptyMatrix, [&]() { matrix->reserve(vertices); });
+    }
+
+    void benchmarkGraphs(size_t n) {
+        int vertices = graphVertices(n);
+
+        if ((double)n > (double)vertices * vertices) {
+            std::fprintf(stderr, "graphs with %zu edges do not fit into %d vertices, skipped\n", n, vertices);
+            return;
+        }
+
+        std::vector<std::tuple<int, int, int>> edges = randomEdges(n, vertices, 4);
+
+        benchmarkGraph<AdjacencyMatrix<int, int>>("AdjacencyMatrix", n, vertices, edges);
+        benchmarkGraph<AdjacencyList<int, int>>("AdjacencyList", n, vertices, edges);
+        benchmarkVertexGrowth(n);
+
+        // the spanning forest is taken on the undirected graph: every edge in both directions
+        std::vector<std::tuple<int, int, int>> undirected;
+        for (const auto& edge : randomEdges(n / 2, vertices, 5)) {
+            undirected.push_back(edge);
+            undirected.push_back(std::make_tuple(std::get<1>(edge), std::get<0>(edge), std::get<2>(edge)));
+        }
+
+        std::vector<int> vertexList(vertices);
+        for (int i = 0; i < vertices; i++)
+            vertexList[i] = i;
+
+        AdjacencyMatrix<int, int> matrix;
+        matrix.insertVertices(vertexList);
+        matrix.insertEdges(undirected);
+
+        AdjacencyList<int, int> list;
+        list.insertVertices(vertexList);
+        list.insertEdges(undirected);
+
+        const std::pair<MsfEngine, std::string> engines[] = {
+            { MsfEngine::LazyPrim,        "LazyPrim" },
+            { MsfEngine::EagerPrim,       "EagerPrim" },
+            { MsfEngine::ParallelBoruvka, "ParallelBoruvka" }
+        };
+
+        for (const auto& engine : engines) {
+            std::vector<std::pair<int, int>> forest;
+
+            measure("GetMinSpanningForest", "AdjacencyMatrix " + engine.second, n, [&]() { forest.clear(); }, [&]() {
+                GetMinSpanningForest(matrix, forest, engine.first, options.threads);
+                sink += forest.size();
+            });
+
+            measure("GetMinSpanningForest", "AdjacencyList " + engine.second, n, [&]() { forest.clear(); }, [&]() {
+                GetMinSpanningForest(list, forest, engine.first, options.threads);
+                sink += forest.size();
+            });
+        }
+
+        for (unsigned threads : threadCounts()) {
+            std::vector<std::pair<int, int>> forest;
+
+            measure("ParallelBoruvka threads", "AdjacencyList threads=" + std::to_string(threads), n, [&]() { forest.clear(); },
+                    [&]() {
+                GetMinSpanningForest(list, forest, MsfEngine::ParallelBoruvka, threads);
+                sink += forest.size();
+            });
+        }
+    }
+
+    /**
+     * @brief benchmarkConcurrentGraph runs a mix of 90% reads and 10% edge updates on a shared
+     *        ConcurrentAdjacencyMatrix from a growing number of threads, n operations are split between the threads
+     */
+    void benchmarkConcurrentGraph(size_t n) {
+        int vertices = graphVertices(n);
+
+        std::vector<std::tuple<int, int, int>> edges = randomEdges(n, vertices, 12);
+
+        for (unsigned threads : threadCounts()) {
+            std::unique_ptr<ConcurrentAdjacencyMatrix<int, int>> graph;
+
+            auto fillGraph = [&]() {
+                graph.reset(new ConcurrentAdjacencyMatrix<int, int>());
+
+                for (int vertex = 0; vertex < vertices; vertex++)
+                    graph->insertVertex(vertex);
+
+                for (size_t i = 0; i < n; i += 2)
+                    graph->insertEdge(std::get<0>(edges[i]), std::get<1>(edges[i]), std::get<2>(edges[i]));
+            };
+
+            auto run = [&](bool byIndex) {
+                std::vector<std::thread> workers;
+                std::atomic<uint64_t>    total(0);
+
+                for (unsigned worker = 0; worker < threads; worker++) {
+                    workers.emplace_back([&, worker]() {
+                        uint64_t local = 0;
+
+                        for (size_t i = worker; i < n; i += threads) {
+                            int from = std::get<0>(edges[i]), to = std::get<1>(edges[i]);
+
+                            if (i % 10 == 0)
+                                graph->insertEdge(from, to, std::get<2>(edges[i]));
+                            else if (i % 10 == 1)
+                                graph->removeEdge(from, to);
+                            else if (byIndex)
+                                local += graph->areAdjacentById(from, to) + graph->degreeById(from); // indexes are vertices
+                            else
+                                local += graph->areAdjacent(from, to) + graph->degree(from);
+                        }
+
+                        total += local;
+                    });
+                }
+
+                for (std::thread& worker : workers)
+                    worker.join();
+
+                sink += total.load();
+            };
+
+            measure("concurrent graph 90% reads", "by vertex threads=" + std::to_string(threads), n, fillGraph,
+                    [&]() { run(false); });
+            measure("concurrent graph 90% reads", "by index threads=" + std::to_string(threads), n, fillGraph,
+                    [&]() { run(true); });
+        }
+    }
+
+    /**
+     * @brief benchmarkGraphFiles compares opening a binary graph file by mmap with reparsing the same graph
+     *        from a text edge list, the graph is sparse: 8 edges per vertex on average
+     */
+    void benchmarkGraphFiles(size_t n) {
+        int vertices = (int)std::max<size_t>(16, n / 8);
+
+        std::vector<std::tuple<int, int, int>> edges = randomEdges(n, vertices, 11);
+
+        const std::string binaryPath = options.directory + "/benchmark_graph.bin";
+        const std::string textPath   = options.directory + "/benchmark_graph.txt";
+
+        {
+            std::vector<int> vertexList(vertices);
+            for (int i = 0; i < vertices; i++)
+                vertexList[i] = i;
+
+            AdjacencyList<int, int> graph;
+            graph.insertVertices(vertexList);
+            graph.insertEdges(edges);
+
+            writeGraphFile(graph.toCSR(), binaryPath);
+
+            std::FILE* text = std::fopen(textPath.c_str(), "w");
+            if (text == nullptr) {
+                std::fprintf(stderr, "cannot create %s, graph files skipped\n", textPath.c_str());
+                return;
+            }
+
+            for (const auto& edge : edges)
+                std::fprintf(text, "%d %d %d\n", std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+
+            std::fclose(text);
+        }
+
+        measure("graph file load", "MappedGraph", n, [&]() {
+            MappedGraph<int, int> graph(binaryPath);
+            sink += graph.degreeById(0);
+        });
+
+        measure("graph file load", "MappedGraph verify", n, [&]() {
+            MappedGraph<int, int> graph(binaryPath);
+            graph.verify();
+            sink += graph.degreeById(0);
+        });
+
+        measure("graph file load", "MappedGraph full traversal", n, [&]() {
+            MappedGraph<int, int> graph(binaryPath);
+
+            for (int index = 0; index < graph.indexCount(); index++)
+                graph.forEachNeighbor(index, [&](int to, int weight) { sink += to + weight; });
+        });
+
+        measure("graph file load", "loadEdgeList text reparse", n, [&]() {
+            AdjacencyList<int, int> graph;
+            loadEdgeList(textPath, graph, options.threads);
+            sink += graph.indexCount();
+        });
+
+        // n of the loader is the size of the file in bytes, so 1000 / ns_per_element is MB/s
+        std::FILE* text  = std::fopen(textPath.c_str(), "rb");
+        size_t     bytes = 0;
+
+        if (text != nullptr) {
+            std::fseek(text, 0, SEEK_END);
+            bytes = (size_t)std::ftell(text);
+            std::fclose(text);
+        }
+
+        for (unsigned threads : threadCounts()) {
+            measure("edge list parse bytes", "parseEdgeList threads=" + std::to_string(threads), bytes, [&]() {
+                sink += parseEdgeList<int, int>(textPath, threads).size();
+            });
+        }
+
+        measure("edge list parse bytes", "loadEdgeList into AdjacencyList", bytes, [&]() {
+            AdjacencyList<int, int> graph;
+            loadEdgeList(textPath, graph, options.threads);
+            sink += graph.indexCount();
+        });
+
+        std::remove(binaryPath.c_str());
+        std::remove(textPath.c_str());
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief The Record struct is a heavy record of 256 bytes keyed by a date
+     */
+    struct Record {
+        Date date;
+        int  id;
+        char payload[244];
+    };
+
+    template <typename T>
+    void benchmarkSortsOf(const std::string& group, const std::vector<T>& input) {
+        size_t         n = input.size();
+        std::vector<T> vector;
+
+        auto copyInput = [&]() { vector = input; };
+
+        measure(group, "mergeSort", n, copyInput, [&]() { mergeSort(vector); });
+        measure(group, "mergeSort range", n, copyInput, [&]() { mergeSort(vector.begin(), vector.end()); });
+        measure(group, "adaptiveMergeSort", n, copyInput, [&]() { adaptiveMergeSort(vector); });
+        measure(group, "parallelMergeSort", n, copyInput, [&]() { parallelMergeSort(vector, options.threads); });
+        measure(group, "std::stable_sort", n, copyInput, [&]() { std::stable_sort(vector.begin(), vector.end()); });
+        measure(group, "std::sort", n, copyInput, [&]() { std::sort(vector.begin(), vector.end()); });
+
+        if constexpr (radix_sort::isSortable<T>())
+            measure(group, "mergeSort RadixSort", n, copyInput, [&]() { mergeSort(vector, SortEngine::RadixSort); });
+
+        if constexpr (simd_sort::isSupported<T>())
+            measure(group, simd_sort::isVectorized<T>() ? "mergeSort Simd AVX2" : "mergeSort Simd portable", n, copyInput,
+                    [&]() { mergeSort(vector, SortEngine::Simd); });
+
+        sink += vector.empty() ? 0 : (uint64_t)(vector[n / 2] < vector[0]);
+    }
+
+    void benchmarkSorts(size_t n) {
+        std::mt19937 random(6);
+
+        std::vector<int> ints(n);
+        for (int& value : ints)
+            value = (int)random();
+
+        benchmarkSortsOf("sort int random", ints);
+
+        for (unsigned threads : threadCounts()) {
+            std::vector<int> vector;
+
+            measure("parallelMergeSort threads", "int random threads=" + std::to_string(threads), n,
+                    [&]() { vector = ints; }, [&]() { parallelMergeSort(vector, threads); });
+        }
+
+        std::sort(ints.begin(), ints.end());
+
+        benchmarkSortsOf("sort int sorted", ints);
+
+        std::reverse(ints.begin(), ints.end());
+
+        benchmarkSortsOf("sort int reversed", ints);
+
+        std::reverse(ints.begin(), ints.end());
+        for (size_t i = 0; i < n / 100; i++)
+            std::swap(ints[random() % n], ints[random() % n]);
+
+        benchmarkSortsOf("sort int nearly sorted", ints);
+
+        std::vector<long long> longs(n);
+        for (long long& value : longs)
+            value = (long long)((uint64_t)random() << 32 | random());
+
+        benchmarkSortsOf("sort long long random", longs);
+
+        std::vector<float> floats(n);
+        for (float& value : floats)
+            value = std::ldexp((float)random(), -16) - 32768.0f;
+
+        benchmarkSortsOf("sort float random", floats);
+
+        std::vector<double> doubles(n);
+        for (double& value : doubles)
+            value = std::ldexp((double)random(), -16) - 32768.0;
+
+        benchmarkSortsOf("sort double random", doubles);
+
+        std::vector<Date> dates(n);
+        for (Date& date : dates)
+            date = Date::FromJulianDay(2440000 + (long long)(random() % 40000));
+
+        benchmarkSortsOf("sort Date random", dates);
+
+        // records of 256 bytes take too much memory at the biggest scales
+        if (n > 10000000)
+            return;
+
+        std::vector<Record> records(n);
+        for (size_t i = 0; i < n; i++) {
+            records[i].date = dates[i];
+            records[i].id   = (int)i;
+            std::memset(records[i].payload, (int)(i & 0xFF), sizeof(records[i].payload));
+        }
+
+        std::vector<Record> vector;
+        auto copyRecords = [&]() { vector = records; };
+        auto byDate      = [](const Record& record1, const Record& record2) { return record1.date < record2.date; };
+
+        measure("sort record by Date", "mergeSort range projection", n, copyRecords,
+                [&]() { mergeSort(vector.begin(), vector.end(), std::less<>(), &Record::date); });
+        measure("sort record by Date", "indirectSort", n, copyRecords,
+                [&]() { indirectSort(vector.begin(), vector.end(), std::less<>(), &Record::date); });
+        measure("sort record by Date", "std::stable_sort", n, copyRecords,
+                [&]() { std::stable_sort(vector.begin(), vector.end(), byDate); });
+    }
+
+    void benchmarkExternalSort(size_t n) {
+        std::vector<int> keys = randomKeys(n, 7);
+
+        // half of the budget goes to the run buffer and half to the scratch of its sort, so the data is sorted in 16 runs
+        size_t budget = std::max<size_t>(n * sizeof(int) / 8, 1 << 16);
+
+        measure("external sort int", "ExternalMergeSort", n, [&]() {
+            ExternalMergeSort<int> sort(budget, options.directory);
+
+            for (int key : keys)
+                sort.push(key);
+
+            sort.finish([&](const int* data, size_t count) { sink += data[count - 1]; });
+        });
+
+        std::vector<int> vector;
+        measure("external sort int", "std::stable_sort in memory", n, [&]() { vector = keys; },
+                [&]() { std::stable_sort(vector.begin(), vector.end()); });
+    }
+
+    void benchmarkDates(size_t n) {
+        std::mt19937 random(8);
+
+        std::vector<Date> dates(n);
+        for (Date& date : dates)
+            date = Date::FromJulianDay(2400000 + (long long)(random() % 80000));
+
+        const size_t STRIDE = 11; // YYYY-MM-DD\n
+        std::string  text(n * STRIDE, '\n');
+
+        formatDates(dates.data(), n, &text[0], STRIDE);
+
+        std::vector<Date> parsed(n);
+
+        measure("date parse", "parseDates", n, [&]() { sink += parseDates(text.data(), n, STRIDE, parsed.data()); });
+
+        measure("date parse", "Date::TryParse", n, [&]() {
+            for (size_t i = 0; i < n; i++)
+                sink += Date::TryParse(std::string_view(text.data() + i * STRIDE, 10), parsed[i]);
+        });
+
+        measure("date parse", "Date::GetDateFromString", n, [&]() {
+            for (size_t i = 0; i < n; i++)
+                parsed[i] = Date::GetDateFromString(std::string(text.data() + i * STRIDE, 10));
+        });
+
+        std::string output(n * STRIDE, '\n');
+
+        measure("date format", "formatDates", n, [&]() { formatDates(dates.data(), n, &output[0], STRIDE); });
+
+        measure("date format", "snprintf", n, [&]() {
+            char buffer[48];
+
+            for (size_t i = 0; i < n; i++) {
+                int year = 0, month = 0, day = 0;
+                dates[i].decode(year, month, day);
+
+                std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", year, month, day);
+                std::memcpy(&output[i * STRIDE], buffer, 10);
+            }
+        });
+
+        sink += output[n * STRIDE / 2];
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief measureResources measures the body with new/delete, with a monotonic arena and with an unsynchronized pool,
+     *        the arena and the pool are made anew for every repeat as they would be per request, and releasing them
+     *        is timed as well
+     */
+    template <typename B>
+    void measureResources(const std::string& group, size_t n, B body) {
+        measure(group, "new/delete", n, [&]() { body(std::pmr::new_delete_resource()); });
+
+        measure(group, "monotonic_buffer_resource", n, [&]() {
+            std::pmr::monotonic_buffer_resource arena;
+            body(&arena);
+        });
+
+        measure(group, "unsynchronized_pool_resource", n, [&]() {
+            std::pmr::unsynchronized_pool_resource pool;
+            body(&pool);
+        });
+    }
+
+    void benchmarkAllocators(size_t n) {
+        std::vector<int> keys = randomKeys(n, 9);
+
+        measureResources("allocator BTree add", n, [&](std::pmr::memory_resource* resource) {
+            BTree<int, int*> tree(32, resource);
+
+            for (size_t i = 0; i < n; i++)
+                tree.add(keys[i], &keys[i]);
+
+            sink += tree.size();
+        });
+
+        measureResources("allocator FibonacciHeap", n, [&](std::pmr::memory_resource* resource) {
+            FibonacciHeap<long long, int> heap(LLONG_MIN, resource);
+
+            for (size_t i = 0; i < n; i++)
+                heap.insert(heap.createNode(keys[i], (int)i));
+
+            while (!heap.isEmpty()) {
+                Node<long long, int>* node = heap.extractMin();
+
+                sink += node->value;
+                heap.destroyNode(node);
+            }
+        });
+
+        int                                    vertices = graphVertices(n);
+        std::vector<std::tuple<int, int, int>> edges    = randomEdges(n, vertices, 10);
+
+        measureResources("allocator AdjacencyMatrix", n, [&](std::pmr::memory_resource* resource) {
+            AdjacencyMatrix<int, int> graph(resource);
+
+            for (int vertex = 0; vertex < vertices; vertex++)
+                graph.insertVertex(vertex);
+
+            for (const auto& edge : edges)
+                graph.insertEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+
+            for (size_t i = 0; i < n; i += 2)
+                graph.removeEdge(std::get<0>(edges[i]), std::get<1>(edges[i]));
+
+            sink += graph.degree(0);
+        });
+
+        // many short sorts, as when every request sorts its own small batch
+        const size_t BATCH = 256;
+
+        std::vector<std::pair<int, int>> batch;
+
+        measureResources("allocator mergeSort batches", n, [&](std::pmr::memory_resource* resource) {
+            for (size_t begin = 0; begin < n; begin += BATCH) {
+                batch.clear();
+                for (size_t i = begin; i < std::min(begin + BATCH, n); i++)
+                    batch.push_back({ keys[i], (int)i });
+
+                mergeSort(batch.begin(), batch.end(), std::less<>(), &std::pair<int, int>::first, resource);
+
+                sink += batch.front().second;
+            }
+        });
+    }
+
+    bool parseOptions(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+
+            if (i + 1 >= argc)
+                return false;
+
+            std::string value = argv[++i];
+
+            if (option == "--min-scale")
+                options.minScale = std::stoull(value);
+            else if (option == "--max-scale")
+                options.maxScale = std::stoull(value);
+            else if (option == "--repeats")
+                options.repeats = std::max(1, std::stoi(value));
+            else if (option == "--threads")
+                options.threads = (unsigned)std::stoul(value);
+            else if (option == "--filter")
+                options.filter = value;
+            else if (option == "--tmp")
+                options.directory = value;
+            else
+                return false;
+        }
+
+        return options.minScale >= 1;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    if (!parseOptions(argc, argv)) {
+        std::cerr << "usage: " << argv[0] << " [--min-scale N] [--max-scale N] [--repeats R] [--filter TEXT]"
+                                             " [--threads T] [--tmp DIRECTORY]" << std::endl;
+        return 2;
+    }
+
+    std::printf("group,variant,n,repeats,best_seconds,median_seconds,ns_per_element\n");
+
+    for (size_t n = options.minScale; n <= options.maxScale; n *= 10) {
+        benchmarkOrderedMaps(n);
+        benchmarkPriorityQueues(n);
+        benchmarkGraphs(n);
+        benchmarkGraphFiles(n);
+        benchmarkConcurrentGraph(n);
+        benchmarkSorts(n);
+        benchmarkExternalSort(n);
+        benchmarkDates(n);
+        benchmarkAllocators(n);
+    }
+
+    return 0;
+}
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <memory_resource>
+
 #include "btree/range_map.h"
 #include "btree/btree_node.h"
 
 /**
- * @brief The BTree class implements range map
+ * @brief The BTree class implements range map, its nodes and their arrays are allocated from a memory resource
+ *        (e.g. std::pmr::monotonic_buffer_resource for a tree per request)
  *
  * @author  Evgeny Gerasimov
  * @version 1.0; 05.04.2022
@@ -20,8 +23,19 @@ private:
     int length;
     int t;
 
+    std::pmr::memory_resource* resource;
+
 public:
-    BTree(int t) : t(t), length(0), root(nullptr) { }
+    BTree(int t, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : root(nullptr), length(0), t(t), resource(resource) { }
+
+    BTree(const BTree&)              = delete;
+    BTree& operator = (const BTree&) = delete;
+
+    ~BTree() {
+        if (root != nullptr)
+            BTreeNode<K, V>::destroy(root);
+    }
 
     int             size();
     bool            isEmpty();
@@ -66,14 +80,16 @@ bool BTree<K, V>::isEmpty() {
 template<typename K, typename V>
 void BTree<K, V>::add(const K& key, const V& value) {
     if (root == nullptr) {
-        root = new BTreeNode<K, V>(t, true);
+        root = BTreeNode<K, V>::create(t, true, resource);
         root->insertInNode(key, value);
 
+        length++;
+
         return;
     }
 
     if (root->isFull(t)) {
-        BTreeNode<K, V>* new_root = new BTreeNode<K, V>(t, false);
+        BTreeNode<K, V>* new_root = BTreeNode<K, V>::create(t, false, resource);
 
         new_root->childs.push_back(root);
 
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <memory_resource>
 
 /**
  * @brief The BTreeNode class implements node for BTree
@@ -20,12 +21,15 @@ private:
     friend class BTree;
 
 protected:
-    std::vector<K>         keys;
-    std::vector<V>         values;
-    std::vector<BTreeNode*> childs;
+    std::pmr::vector<K>          keys;
+    std::pmr::vector<V>          values;
+    std::pmr::vector<BTreeNode*> childs;
 
     bool is_leaf;
 
+    static BTreeNode* create(int t, bool is_leaf, std::pmr::memory_resource* resource);
+    static void       destroy(BTreeNode* node);
+
     void search(const K& from, const K& to,
                 std::vector<V>& range,
                 const bool& first_el_only);
@@ -41,7 +45,8 @@ protected:
     void   insert(const K& key, const V& value, const int& t);
 
 public:
-    BTreeNode(int t, bool is_leaf = false) {
+    BTreeNode(int t, bool is_leaf = false, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : keys(resource), values(resource), childs(resource) {
         keys.reserve(2*t);
         values.reserve(2*t);
         childs.reserve(2*t);
@@ -50,6 +55,42 @@ public:
     }
 };
 
+/**
+ * Worst case time complexity - O(t)
+ *
+ * @brief create allocates a node and the arrays of its keys, values and children from the memory resource
+ * @param t - minimum degree of a B-Tree
+ * @param is_leaf - true if the node is a leaf
+ * @param resource - memory resource of the tree
+ * @return new node
+ */
+template<typename K, typename V>
+BTreeNode<K, V>* BTreeNode<K, V>::create(int t, bool is_leaf, std::pmr::memory_resource* resource) {
+    std::pmr::polymorphic_allocator<BTreeNode<K, V>> allocator(resource);
+
+    BTreeNode<K, V>* node = allocator.allocate(1);
+    allocator.construct(node, t, is_leaf, resource);
+
+    return node;
+}
+
+/**
+ * Worst case time complexity - O(number of nodes in the subtree)
+ *
+ * @brief destroy frees the node with all its subtree back to the memory resource they were allocated from
+ * @param node - root of the subtree
+ */
+template<typename K, typename V>
+void BTreeNode<K, V>::destroy(BTreeNode* node) {
+    for (BTreeNode* child : node->childs)
+        destroy(child);
+
+    std::pmr::polymorphic_allocator<BTreeNode<K, V>> allocator(node->keys.get_allocator().resource());
+
+    node->~BTreeNode();
+    allocator.deallocate(node, 1);
+}
+
 /**
  * Worst case time complexity - O(BTree.length)
  *
@@ -109,7 +150,7 @@ size_t BTreeNode<K, V>::insertInNode(const K& key, const V& value) {
     if (!is_leaf)
         return -1;
 
-    typename std::vector<K>::iterator it = keys.insert(std::upper_bound(keys.cbegin(), keys.cend(), key), key);
+    typename std::pmr::vector<K>::iterator it = keys.insert(std::upper_bound(keys.cbegin(), keys.cend(), key), key);
     values.insert(values.cbegin() + (it - keys.cbegin()), value);
 
     return it - keys.cbegin();
@@ -126,7 +167,7 @@ template<typename K, typename V>
 void BTreeNode<K, V>::splitChild(BTreeNode *child, int index) {
     int t = (child->size() + 1) / 2;
 
-    BTreeNode<K, V>* new_right_node = new BTreeNode<K, V>(t, child->is_leaf);
+    BTreeNode<K, V>* new_right_node = create(t, child->is_leaf, keys.get_allocator().resource());
 
     size_t mid = child->size() / 2;
 
@@ -135,27 +176,17 @@ void BTreeNode<K, V>::splitChild(BTreeNode *child, int index) {
     values.insert(values.cbegin() + index, child->values[mid]);
     childs.insert(childs.cbegin() + index + 1, new_right_node);
 
-    // splitting keys and values between 2 nodes
-    std::vector<K> left_child_keys(child->keys.cbegin(), child->keys.cbegin() + mid);
-    std::vector<V> left_child_values(child->values.cbegin(), child->values.cbegin() + mid);
-
-    std::vector<K> right_child_keys(child->keys.cbegin() + mid + 1, child->keys.cend());
-    std::vector<V> right_child_values(child->values.cbegin() + mid + 1, child->values.cend());
+    // moving the right half of keys and values into the new node, the left half stays in place
+    new_right_node->keys.assign(child->keys.cbegin() + mid + 1, child->keys.cend());
+    new_right_node->values.assign(child->values.cbegin() + mid + 1, child->values.cend());
 
-    // assigning new keys and values
-    child->keys = left_child_keys;
-    child->values = left_child_values;
-
-    new_right_node->keys = right_child_keys;
-    new_right_node->values = right_child_values;
+    child->keys.erase(child->keys.cbegin() + mid, child->keys.cend());
+    child->values.erase(child->values.cbegin() + mid, child->values.cend());
 
     // if not a leaf - splitting also childs
     if (!child->is_leaf) {
-        std::vector<BTreeNode*> left_child_childs(child->childs.cbegin(), child->childs.cbegin() + mid + 1);
-        std::vector<BTreeNode*> right_child_childs(child->childs.cbegin() + mid + 1, child->childs.cend());
-
-        child->childs          = left_child_childs;
-        new_right_node->childs = right_child_childs;
+        new_right_node->childs.assign(child->childs.cbegin() + mid + 1, child->childs.cend());
+        child->childs.erase(child->childs.cbegin() + mid + 1, child->childs.cend());
     }
 }
 
@@ -1,11 +1,2250 @@
 #include <iostream>
 #include <vector>
 #include <climits>
+#include <map>
+#include <unordered_map>
+#include <set>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <tuple>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <iterator>
+#include <cstring>
+#include <cstddef>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <memory_resource>
 
 #include "btree/btree.h"
 #include "fibonacci_heap/fibonacci_heap.h"
 #include "fibonacci_heap/fibonacci_heap_node.h"
 #include "graph/graph_on_adjacency_matrix.h"
+#include "graph/graph_on_adjacency_list.h"
+#include "graph/small_vector.h"
+#include "graph/csr_graph.h"
+#include "graph/flat_hash_map.h"
+#include "graph/vertex_interner.h"
+#include "graph/graph_file.h"
+#include "graph/edge_list_loader.h"
+#include "graph/concurrent_adjacency_matrix.h"
+#include "algorithms/prim.h"
+#include "algorithms/dynamic_msf.h"
+#include "algorithms/shortest_paths.h"
+#include "algorithms/parallel_merge_sort.h"
+#include "algorithms/adaptive_merge_sort.h"
+#include "algorithms/external_merge_sort.h"
+#include "algorithms/radix_sort.h"
+#include "algorithms/indirect_sort.h"
+#include "algorithms/merge_sort.h"
+#include "algorithms/date.h"
+#include "algorithms/date_parser.h"
+
+namespace {
+
+    int failures = 0;
+
+    /**
+     * @brief check prints a failed check, checker returns 1 if any of them failed
+     * @param condition - checked condition
+     * @param description - what is checked
+     */
+    void check(bool condition, const std::string& description) {
+        if (!condition) {
+            std::cout << "FAILED: " << description << std::endl;
+            failures++;
+        }
+    }
+
+    void printTitle(const std::string& title) {
+        std::string line(title.size() + 8, '/');
+
+        std::cout << line << std::endl <<
+                     "/// " << title << " ///" << std::endl <<
+                     line << std::endl << std::endl;
+    }
+
+    /**
+     * @brief The GraphModel struct is a reference undirected graph, its edges are stored in both directions
+     */
+    struct GraphModel {
+        std::set<int>                      vertices;
+        std::map<std::pair<int, int>, int> edges; // (from, to) -> weight
+
+        void insertEdge(int from, int to, int weight) {
+            edges[{ from, to }] = weight;
+            edges[{ to, from }] = weight;
+        }
+
+        void removeVertex(int vertex) {
+            vertices.erase(vertex);
+
+            for (auto it = edges.begin(); it != edges.end(); )
+                it = it->first.first == vertex || it->first.second == vertex ? edges.erase(it) : std::next(it);
+        }
+
+        std::set<std::pair<int, int>> neighbors(int vertex) const {
+            std::set<std::pair<int, int>> result; // (to, weight)
+
+            for (auto it = edges.lower_bound({ vertex, INT_MIN }); it != edges.end() && it->first.first == vertex; ++it)
+                result.insert({ it->first.second, it->second });
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief randomGraphModel returns a random undirected graph with distinct vertices from [0, 1000)
+     *        and weights from [1, 1000]
+     */
+    GraphModel randomGraphModel(std::mt19937& random, int maximumVertices, int edgesPerVertex) {
+        GraphModel model;
+
+        int vertices = 1 + (int)(random() % maximumVertices);
+        while ((int)model.vertices.size() < vertices)
+            model.vertices.insert((int)(random() % 1000));
+
+        std::vector<int> list(model.vertices.begin(), model.vertices.end());
+
+        for (int i = (int)(random() % (vertices * edgesPerVertex + 1)); i > 0; i--) {
+            int from = list[random() % list.size()];
+            int to   = list[random() % list.size()];
+
+            if (from != to)
+                model.insertEdge(from, to, 1 + (int)(random() % 1000));
+        }
+
+        return model;
+    }
+
+    /**
+     * @brief The DisjointSets struct is a reference union-find over any vertices
+     */
+    struct DisjointSets {
+        std::map<int, int> parent;
+
+        int find(int vertex) {
+            if (parent.count(vertex) == 0)
+                parent[vertex] = vertex;
+
+            while (parent[vertex] != vertex)
+                vertex = parent[vertex] = parent[parent[vertex]];
+
+            return vertex;
+        }
+
+        bool unite(int a, int b) {
+            a = find(a);
+            b = find(b);
+
+            parent[a] = b;
+
+            return a != b;
+        }
+    };
+
+    /**
+     * @brief kruskalForest returns the number of edges and the weight of a minimum spanning forest of the model
+     */
+    std::pair<size_t, long long> kruskalForest(const GraphModel& model) {
+        std::vector<std::pair<int, std::pair<int, int>>> edges;
+
+        for (const auto& edge : model.edges)
+            edges.push_back({ edge.second, edge.first });
+
+        std::sort(edges.begin(), edges.end());
+
+        DisjointSets sets;
+        size_t       size   = 0;
+        long long    weight = 0;
+
+        for (const auto& edge : edges) {
+            if (sets.unite(edge.second.first, edge.second.second)) {
+                size++;
+                weight += edge.first;
+            }
+        }
+
+        return { size, weight };
+    }
+
+    /**
+     * @brief checkForest checks that the forest consists of edges of the model, has no cycles
+     *        and is as big and as light as the one found by Kruskal algorithm
+     */
+    void checkForest(const std::string& name, const std::vector<std::pair<int, int>>& forest, const GraphModel& model) {
+        DisjointSets sets;
+        bool         valid  = true;
+        long long    weight = 0;
+
+        for (const std::pair<int, int>& edge : forest) {
+            auto it = model.edges.find(edge);
+
+            if (it == model.edges.end() || !sets.unite(edge.first, edge.second)) {
+                valid = false;
+                break;
+            }
+
+            weight += it->second;
+        }
+
+        std::pair<size_t, long long> expected = kruskalForest(model);
+
+        check(valid && forest.size() == expected.first && weight == expected.second,
+              name + " is not a minimum spanning forest");
+    }
+
+    template <typename G>
+    void fillGraph(G& graph, const GraphModel& model) {
+        for (int vertex : model.vertices)
+            graph.insertVertex(vertex);
+
+        for (const auto& edge : model.edges)
+            graph.insertEdge(edge.first.first, edge.first.second, edge.second);
+    }
+
+    void checkCsrGraph() {
+        printTitle("CSR GRAPH CHECK");
+
+        std::mt19937 random(26);
+
+        for (int round = 0; round < 50; round++) {
+            GraphModel                model = randomGraphModel(random, 40, 3);
+            AdjacencyMatrix<int, int> graph;
+
+            fillGraph(graph, model);
+
+            // removed vertices leave holes in the indexes of the matrix, the snapshot renumbers around them
+            for (int removed = (int)(random() % 3); removed > 0 && model.vertices.size() > 1; removed--) {
+                int vertex = *std::next(model.vertices.begin(), random() % model.vertices.size());
+
+                graph.removeVertex(vertex);
+                model.removeVertex(vertex);
+            }
+
+            CSRGraph<int, int> csr = graph.toCSR();
+
+            check(csr.numberOfVertices == (int)model.vertices.size() && csr.numberOfEdges() == model.edges.size(),
+                  "toCSR() keeps the numbers of vertices and edges");
+
+            for (int i = 0; i < csr.indexCount(); i++) {
+                std::set<std::pair<int, int>> neighbors;
+
+                csr.forEachNeighbor(i, [&](int to, const int& weight) { neighbors.insert({ csr.vertexAt(to), weight }); });
+
+                check(csr.indexOf(csr.vertexAt(i)) == i && csr.degreeById(i) == (int)neighbors.size() &&
+                      neighbors == model.neighbors(csr.vertexAt(i)),
+                      "edges of vertex " + std::to_string(csr.vertexAt(i)) + " in the CSR snapshot");
+            }
+
+            std::vector<std::pair<int, int>> matrixForest;
+            std::vector<std::pair<int, int>> csrForest;
+
+            GetMinSpanningForest(graph, matrixForest);
+            GetMinSpanningForest(csr, csrForest);
+
+            checkForest("Prim on AdjacencyMatrix", matrixForest, model);
+            checkForest("Prim on CSRGraph", csrForest, model);
+        }
+
+        std::cout << "CSR snapshots and their spanning forests checked" << std::endl << std::endl;
+    }
+
+    /**
+     * @brief checkGraphEdges compares all the directed edges of a graph with the model
+     */
+    template <typename G>
+    void checkGraphEdges(const std::string& name, const G& graph, const GraphModel& model) {
+        size_t vertices = 0;
+
+        for (int i = 0; i < graph.indexCount(); i++) {
+            if (!graph.indexExist(i))
+                continue;
+
+            vertices++;
+
+            std::set<std::pair<int, int>> neighbors;
+
+            graph.forEachNeighbor(i, [&](int to, const int& weight) { neighbors.insert({ graph.vertexAt(to), weight }); });
+
+            check(neighbors == model.neighbors(graph.vertexAt(i)),
+                  "edges of vertex " + std::to_string(graph.vertexAt(i)) + " in " + name);
+        }
+
+        check(vertices == model.vertices.size(), "number of vertices in " + name);
+    }
+
+    /**
+     * @brief checkRandomOperations applies random operations to a graph and to a directed model
+     *        and compares their answers
+     */
+    template <typename G>
+    void checkRandomOperations(const std::string& name, G& graph, GraphModel& model, std::mt19937& random,
+                               int operations, int vertexSpace) {
+        for (int operation = 0; operation < operations; operation++) {
+            int from   = (int)(random() % vertexSpace);
+            int to     = (int)(random() % vertexSpace);
+            int weight = 1 + (int)(random() % 1000);
+            int kind   = (int)(random() % 10);
+
+            if (kind < 2) {
+                graph.insertVertex(from);
+                model.vertices.insert(from);
+            } else if (kind < 3) {
+                graph.removeVertex(from);
+                model.removeVertex(from);
+            } else if (kind < 7) {
+                graph.insertEdge(from, to, weight);
+
+                if (model.vertices.count(from) != 0 && model.vertices.count(to) != 0)
+                    model.edges[{ from, to }] = weight;
+            } else if (kind < 8) {
+                graph.removeEdge(from, to);
+                model.edges.erase({ from, to });
+            } else {
+                bool adjacent = model.edges.count({ from, to }) != 0 || model.edges.count({ to, from }) != 0;
+                int  degree   = model.vertices.count(from) != 0 ? (int)model.neighbors(from).size() : -1;
+
+                check(graph.areAdjacent(from, to) == adjacent && graph.degree(from) == degree,
+                      name + ": adjacency and degree of vertex " + std::to_string(from));
+            }
+        }
+
+        checkGraphEdges(name, graph, model);
+    }
+
+    /**
+     * @brief The CopyCounter struct counts its copies, moves are not counted
+     */
+    struct CopyCounter {
+        static int copies;
+
+        CopyCounter() { }
+        CopyCounter(const CopyCounter&) { copies++; }
+        CopyCounter(CopyCounter&&) noexcept { }
+
+        CopyCounter& operator = (const CopyCounter&) { copies++; return *this; }
+        CopyCounter& operator = (CopyCounter&&) noexcept { return *this; }
+    };
+
+    int CopyCounter::copies = 0;
+
+    void checkSmallVector() {
+        static_assert(std::is_nothrow_move_constructible<SmallVector<int, 4>>::value &&
+                      std::is_nothrow_move_assignable<SmallVector<int, 4>>::value,
+                      "SmallVector must be moved, not copied, when std::vector grows");
+
+        // std::vector moves the lists when it grows
+        std::vector<SmallVector<CopyCounter, 2>> lists;
+
+        for (int i = 0; i < 100; i++) {
+            lists.emplace_back();
+
+            for (int j = 0; j < i % 5; j++)
+                lists.back().push_back(CopyCounter());
+        }
+
+        check(CopyCounter::copies == 0, "growth of std::vector copies SmallVector");
+
+        // an element of the vector is appended while the vector grows from the inline storage and on the heap
+        SmallVector<std::string, 2> strings;
+        std::vector<std::string>    expected;
+
+        for (int i = 0; i < 40; i++) {
+            if (i < 2) {
+                strings.push_back(std::string(32, (char)('a' + i)));
+                expected.push_back(std::string(32, (char)('a' + i)));
+            } else if (i % 2 == 0) {
+                strings.push_back(strings[0]);
+                expected.push_back(expected[0]);
+            } else {
+                std::string last = strings[strings.size() - 1];
+
+                strings.push_back(std::move(strings[strings.size() - 1]));
+                strings[strings.size() - 2] = last;
+                expected.push_back(expected.back());
+            }
+        }
+
+        check(std::vector<std::string>(strings.begin(), strings.end()) == expected,
+              "push_back of an element of the SmallVector itself");
+    }
+
+    void checkAdjacencyList() {
+        printTitle("ADJACENCY LIST CHECK");
+
+        checkSmallVector();
+
+        std::mt19937 random(27);
+
+        AdjacencyList<int, int> graph;
+        GraphModel              model; // edges are directed here
+
+        checkRandomOperations("AdjacencyList", graph, model, random, 20000, 60);
+
+        for (int round = 0; round < 50; round++) {
+            GraphModel              model = randomGraphModel(random, 40, 3);
+            AdjacencyList<int, int> list;
+
+            fillGraph(list, model);
+
+            CSRGraph<int, int> csr = list.toCSR();
+            checkGraphEdges("CSR snapshot of AdjacencyList", csr, model);
+
+            std::vector<std::pair<int, int>> forest;
+            GetMinSpanningForest(list, forest);
+
+            checkForest("Prim on AdjacencyList", forest, model);
+        }
+
+        std::cout << "AdjacencyList checked against a reference graph" << std::endl << std::endl;
+    }
+
+    void checkBitRows() {
+        printTitle("ADJACENCY MATRIX BIT ROWS CHECK");
+
+        std::mt19937 random(28);
+
+        // vertices of a wide range make rows of several words
+        for (int round = 0; round < 10; round++) {
+            AdjacencyMatrix<int, int> graph;
+            GraphModel                model; // edges are directed here
+
+            checkRandomOperations("AdjacencyMatrix", graph, model, random, 5000, 200);
+
+            check(graph.numberOfEdges() == model.edges.size(), "numberOfEdges() of AdjacencyMatrix");
+
+            for (int i = 0; i < graph.lastIndex; i++)
+                check((uintptr_t)graph.edgeRow(i) % bit_row::ROW_ALIGNMENT == 0,
+                      "row " + std::to_string(i) + " of the bits of AdjacencyMatrix is aligned and padded");
+
+            for (int vertex1 : model.vertices) {
+                int inDegree = 0;
+
+                for (const auto& edge : model.edges)
+                    inDegree += edge.first.second == vertex1;
+
+                check(graph.inDegreeOf(vertex1) == inDegree, "inDegreeOf(" + std::to_string(vertex1) + ")");
+
+                int vertex2 = (int)(random() % 200);
+                int common  = -1;
+
+                if (model.vertices.count(vertex2) != 0) {
+                    common = 0;
+
+                    for (const std::pair<int, int>& edge : model.neighbors(vertex1))
+                        common += model.edges.count({ vertex2, edge.first }) != 0;
+                }
+
+                check(graph.commonNeighbors(vertex1, vertex2) == common,
+                      "commonNeighbors(" + std::to_string(vertex1) + ", " + std::to_string(vertex2) + ")");
+            }
+        }
+
+        std::cout << "degrees, common neighbors and numbers of edges checked" << std::endl << std::endl;
+    }
+
+    void checkFlatBuffers() {
+        printTitle("ADJACENCY MATRIX FLAT BUFFERS CHECK");
+
+        std::mt19937 random(29);
+
+        // growth, reserve and shrinkToFit move rows between buffers of different strides
+        for (int round = 0; round < 10; round++) {
+            AdjacencyMatrix<int, int> graph;
+            GraphModel                model;
+
+            checkRandomOperations("growing AdjacencyMatrix", graph, model, random, 3000, 150);
+
+            graph.reserve(graph.maximumSize + 1 + (int)(random() % 300));
+            checkGraphEdges("reserved AdjacencyMatrix", graph, model);
+
+            graph.shrinkToFit();
+            check(graph.maximumSize == std::max(graph.lastIndex, 1), "shrinkToFit() keeps only used rows");
+            checkGraphEdges("shrunk AdjacencyMatrix", graph, model);
+
+            checkRandomOperations("shrunk AdjacencyMatrix", graph, model, random, 1000, 150);
+        }
+
+        std::cout << "growth, reserve and shrinkToFit checked" << std::endl << std::endl;
+    }
+
+    struct CollidingHash { // makes long probe sequences, so that backward shift deletion is exercised
+        size_t operator()(int key) const {
+            return (size_t)(key % 7);
+        }
+    };
+
+    template <typename H>
+    void checkFlatHashMap(const std::string& name, std::mt19937& random) {
+        FlatHashMap<int, int, H>     map;
+        std::unordered_map<int, int> reference;
+
+        for (int operation = 0; operation < 20000; operation++) {
+            int key  = (int)(random() % 500);
+            int kind = (int)(random() % 3);
+
+            if (kind == 0) {
+                bool inserted = reference.count(key) == 0;
+                reference[key] = operation;
+                check(map.insert(key, operation) == inserted, name + ": insert(" + std::to_string(key) + ")");
+            } else if (kind == 1) {
+                check(map.erase(key) == (reference.erase(key) == 1), name + ": erase(" + std::to_string(key) + ")");
+            } else {
+                const int* value = map.find(key);
+                auto       found = reference.find(key);
+
+                check(found == reference.end() ? value == nullptr : value != nullptr && *value == found->second,
+                      name + ": find(" + std::to_string(key) + ")");
+            }
+        }
+
+        check(map.size() == reference.size(), name + ": size()");
+
+        for (int key = 0; key < 500; key++)
+            check(map.count(key) == reference.count(key), name + ": count(" + std::to_string(key) + ")");
+    }
+
+    void checkVertexInterner() {
+        printTitle("VERTEX INTERNER CHECK");
+
+        std::mt19937 random(30);
+
+        checkFlatHashMap<std::hash<int>>("FlatHashMap", random);
+        checkFlatHashMap<CollidingHash>("colliding FlatHashMap", random);
+
+        VertexInterner<std::string> interner;
+        std::map<std::string, int>  reference;
+        std::vector<int>            freeIndexes;
+        int                         lastIndex = 0;
+
+        for (int operation = 0; operation < 5000; operation++) {
+            std::string vertex = "v" + std::to_string(random() % 300);
+
+            if (random() % 2 == 0 && reference.count(vertex) == 0) {
+                int index = freeIndexes.empty() ? lastIndex++ : freeIndexes.back();
+
+                if (!freeIndexes.empty())
+                    freeIndexes.pop_back();
+
+                interner.bind(vertex, index);
+                reference[vertex] = index;
+            } else if (reference.count(vertex) != 0) {
+                interner.unbind(reference[vertex]);
+                freeIndexes.push_back(reference[vertex]);
+                reference.erase(vertex);
+            }
+
+            check(interner.contains(vertex) == (reference.count(vertex) != 0), "contains(" + vertex + ")");
+        }
+
+        check(interner.size() == reference.size(), "size() of VertexInterner");
+
+        for (const auto& entry : reference)
+            check(interner.indexOf(entry.first) == entry.second && interner.indexExist(entry.second) &&
+                  interner.vertexAt(entry.second) == entry.first, "binding of " + entry.first);
+
+        for (int index : freeIndexes)
+            check(!interner.indexExist(index), "released index " + std::to_string(index));
+
+        std::cout << "FlatHashMap and VertexInterner checked against standard containers" << std::endl << std::endl;
+    }
+
+    void checkCompaction() {
+        printTitle("ADJACENCY MATRIX COMPACTION CHECK");
+
+        std::mt19937 random(31);
+
+        // removals leave holes, compact() must renumber the rest without losing or inventing edges
+        for (int round = 0; round < 10; round++) {
+            AdjacencyMatrix<int, int> graph;
+            GraphModel                model;
+
+            checkRandomOperations("AdjacencyMatrix before compact()", graph, model, random, 4000, 120);
+
+            graph.compact();
+
+            check(graph.numberOfVertices == (int)model.vertices.size() &&
+                  graph.lastIndex == graph.numberOfVertices, "compact() leaves a dense prefix of indexes");
+            check(graph.numberOfEdges() == model.edges.size(), "numberOfEdges() after compact()");
+            checkGraphEdges("compacted AdjacencyMatrix", graph, model);
+
+            checkRandomOperations("AdjacencyMatrix after compact()", graph, model, random, 2000, 120);
+            check(graph.numberOfVertices == (int)model.vertices.size(), "numberOfVertices after removals");
+        }
+
+        std::cout << "removeVertex and compact checked" << std::endl << std::endl;
+    }
+
+    template <typename G>
+    void checkBatchInsertion(const std::string& name, std::mt19937& random) {
+        for (int round = 0; round < 10; round++) {
+            G          graph;
+            GraphModel model;
+
+            // a second batch goes into a graph that already has vertices and edges
+            for (int batch = 0; batch < 2; batch++) {
+                std::vector<int>                       vertices;
+                std::vector<std::tuple<int, int, int>> edges;
+
+                for (int i = 0; i < 80; i++)
+                    vertices.push_back((int)(random() % 100));
+
+                // duplicates, self loops and edges to missing vertices are all in the batch
+                for (int i = 0; i < 1500; i++)
+                    edges.emplace_back((int)(random() % 110), (int)(random() % 110), 1 + (int)(random() % 1000));
+
+                graph.insertVertices(vertices);
+                model.vertices.insert(vertices.begin(), vertices.end());
+
+                graph.insertEdges(edges);
+
+                for (const auto& edge : edges)
+                    if (model.vertices.count(std::get<0>(edge)) != 0 && model.vertices.count(std::get<1>(edge)) != 0)
+                        model.edges[{ std::get<0>(edge), std::get<1>(edge) }] = std::get<2>(edge);
+
+                checkGraphEdges(name + " after insertEdges()", graph, model);
+            }
+
+            checkRandomOperations(name + " after insertEdges()", graph, model, random, 1000, 110);
+        }
+    }
+
+    void checkBatchInsertion() {
+        printTitle("BATCH INSERTION CHECK");
+
+        std::mt19937 random(32);
+
+        checkBatchInsertion<AdjacencyMatrix<int, int>>("AdjacencyMatrix", random);
+        checkBatchInsertion<AdjacencyList<int, int>>("AdjacencyList", random);
+
+        std::cout << "insertVertices and insertEdges checked against per-edge insertion" << std::endl << std::endl;
+    }
+
+    template <typename F>
+    void checkThrows(F function, const std::string& description) {
+        bool thrown = false;
+
+        try {
+            function();
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+
+        check(thrown, description + " throws std::runtime_error");
+    }
+
+    template <typename T>
+    void corruptGraphFile(const std::string& path, const std::vector<char>& bytes, uint64_t position, const T& value) {
+        std::vector<char> corrupted = bytes;
+        std::memcpy(corrupted.data() + position, &value, sizeof(value));
+
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(corrupted.data(), corrupted.size());
+    }
+
+    void checkCorruptedGraphFiles(const std::string& path, std::mt19937& random) {
+        GraphModel                model = randomGraphModel(random, 30, 3);
+        AdjacencyMatrix<int, int> graph;
+
+        fillGraph(graph, model);
+        writeGraphFile(graph.toCSR(), path);
+
+        std::ifstream     file(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        GraphFileHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        uint64_t vertices = header.numberOfVertices;
+
+        corruptGraphFile(path, bytes, offsetof(GraphFileHeader, targetsOffset), header.targetsOffset + 64);
+        checkThrows([&]() { MappedGraph<int, int> mapped(path); }, "mapping a file with a moved section");
+
+        corruptGraphFile(path, bytes, offsetof(GraphFileHeader, numberOfVertices), vertices + 1000000);
+        checkThrows([&]() { MappedGraph<int, int> mapped(path); }, "mapping a file with a wrong number of vertices");
+
+        corruptGraphFile(path, bytes, header.offsetsOffset + vertices * sizeof(uint64_t), header.numberOfEdges - 1);
+        checkThrows([&]() { MappedGraph<int, int> mapped(path); }, "mapping a file whose offsets miss the last edge");
+
+        // edges are checked only by verify(), mapping itself does not read them
+        corruptGraphFile(path, bytes, header.offsetsOffset + sizeof(uint64_t), header.numberOfEdges + 1);
+        checkThrows([&]() { MappedGraph<int, int>(path).verify(); }, "verifying a file with decreasing offsets");
+
+        corruptGraphFile(path, bytes, header.targetsOffset, (int32_t)vertices);
+        checkThrows([&]() { MappedGraph<int, int>(path).verify(); }, "verifying a file with a target out of range");
+
+        corruptGraphFile(path, bytes, header.targetsOffset, (int32_t)-1);
+        checkThrows([&]() { MappedGraph<int, int>(path).verify(); }, "verifying a file with a negative target");
+
+        MappedGraph<int, int> unverified(path);
+        check(unverified.numberOfEdges() == model.edges.size(), "mapping a file with a negative target does not read edges");
+
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size());
+        MappedGraph<int, int> mapped(path);
+        mapped.verify();
+        check(mapped.numberOfEdges() == model.edges.size(), "the file that was corrupted is restored");
+    }
+
+    void checkGraphFile() {
+        printTitle("GRAPH FILE CHECK");
+
+        std::mt19937 random(33);
+
+        const std::string path = "checker_graph_file.bin";
+
+        for (int round = 0; round < 20; round++) {
+            GraphModel                model = randomGraphModel(random, 60, 3);
+            AdjacencyMatrix<int, int> graph;
+
+            fillGraph(graph, model);
+            writeGraphFile(graph.toCSR(), path);
+
+            MappedGraph<int, int> mapped(path);
+
+            check(mapped.numberOfEdges() == model.edges.size(), "numberOfEdges() of MappedGraph");
+            checkGraphEdges("MappedGraph", mapped, model);
+
+            std::vector<std::pair<int, int>> forest;
+            GetMinSpanningForest(mapped, forest);
+            checkForest("Prim on MappedGraph", forest, model);
+        }
+
+        checkThrows([&]() { MappedGraph<int, double> mapped(path); }, "mapping a file of other edge type");
+        checkThrows([&]() { MappedGraph<int, int> mapped("checker_missing_graph_file.bin"); }, "mapping a missing file");
+
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(200, 'x');
+        checkThrows([&]() { MappedGraph<int, int> mapped(path); }, "mapping a file that is not a graph file");
+
+        checkCorruptedGraphFiles(path, random);
+
+        std::remove(path.c_str());
+
+        std::cout << "graph files checked by the round trip through writeGraphFile and MappedGraph" << std::endl << std::endl;
+    }
+
+    void checkEdgeListLoader() {
+        printTitle("EDGE LIST LOADER CHECK");
+
+        std::mt19937 random(34);
+
+        const std::string path = "checker_edge_list.txt";
+
+        for (int round = 0; round < 20; round++) {
+            std::string                            text;
+            std::vector<std::tuple<int, int, int>> expected;
+            size_t                                 malformed = 0;
+
+            // comments, blank lines, CRLF endings, extra spaces and broken lines are mixed with edges
+            for (int line = (int)(random() % 300); line > 0; line--) {
+                int kind = (int)(random() % 10);
+
+                if (kind == 0) {
+                    text += "# comment 1 2 3\n";
+                } else if (kind == 1) {
+                    text += random() % 2 == 0 ? "\n" : "  \t\r\n";
+                } else if (kind == 2) {
+                    text += random() % 2 == 0 ? "1 2\n" : "1 2 x3\n";
+                    malformed++;
+                } else {
+                    int from = (int)(random() % 50), to = (int)(random() % 50), weight = (int)(random() % 1000) - 100;
+
+                    text += (random() % 2 == 0 ? "" : " ") + std::to_string(from) + " \t" + std::to_string(to) + "  " +
+                            std::to_string(weight) + (random() % 2 == 0 ? "\n" : "\r\n");
+                    expected.emplace_back(from, to, weight);
+                }
+            }
+
+            if (!text.empty() && random() % 2 == 0)
+                text.pop_back(); // the last line may end without a line feed
+
+            std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+
+            for (unsigned threads : { 1u, 2u, 3u, 8u }) {
+                EdgeListStats                          stats;
+                std::vector<std::tuple<int, int, int>> edges = parseEdgeList<int, int>(path, threads, &stats);
+
+                check(edges == expected && stats.edges == expected.size() && stats.malformedLines == malformed &&
+                      stats.bytes == text.size(), "parseEdgeList on " + std::to_string(threads) + " threads");
+            }
+
+            AdjacencyList<int, int> graph;
+            GraphModel              model;
+
+            for (const auto& edge : expected) {
+                model.vertices.insert(std::get<0>(edge));
+                model.vertices.insert(std::get<1>(edge));
+                model.edges[{ std::get<0>(edge), std::get<1>(edge) }] = std::get<2>(edge);
+            }
+
+            EdgeListStats stats = loadEdgeList(path, graph, 2);
+
+            check(stats.edges == expected.size(), "loadEdgeList statistics");
+            checkGraphEdges("graph loaded by loadEdgeList", graph, model);
+        }
+
+        std::remove(path.c_str());
+
+        std::cout << "parseEdgeList and loadEdgeList checked" << std::endl << std::endl;
+    }
+
+    void checkConcurrentAdjacencyMatrix() {
+        printTitle("CONCURRENT ADJACENCY MATRIX CHECK");
+
+        const int WRITERS  = 4;
+        const int VERTICES = 100;
+
+        for (int round = 0; round < 5; round++) {
+            ConcurrentAdjacencyMatrix<int, int> graph;
+
+            for (int i = 0; i < VERTICES; i++)
+                graph.insertVertex(i);
+
+            // every writer owns the rows of its vertices, so the final state of every row is known
+            std::vector<std::map<std::pair<int, int>, int>> models(WRITERS);
+            std::vector<std::thread>                        threads;
+            std::atomic<bool>                               writing(true);
+
+            for (int writer = 0; writer < WRITERS; writer++) {
+                threads.emplace_back([&, writer]() {
+                    std::mt19937 random(350 + round * WRITERS + writer);
+
+                    for (int operation = 0; operation < 20000; operation++) {
+                        int from   = writer + WRITERS * (int)(random() % (VERTICES / WRITERS));
+                        int to     = (int)(random() % VERTICES);
+                        int weight = 1 + (int)(random() % 1000);
+
+                        if (random() % 3 != 0) {
+                            graph.insertEdge(from, to, weight);
+                            models[writer][{ from, to }] = weight;
+                        } else {
+                            graph.removeEdge(from, to);
+                            models[writer].erase({ from, to });
+                        }
+                    }
+                });
+            }
+
+            int removedVertices = 0;
+
+            // the matrix grows and loses vertices while edges are updated
+            threads.emplace_back([&]() {
+                for (int i = VERTICES; i < 4 * VERTICES; i++) {
+                    graph.insertVertex(i);
+
+                    if (i % 3 == 0) {
+                        graph.removeVertex(i - 1);
+                        removedVertices++;
+                    }
+                }
+            });
+
+            std::atomic<long long> reads(0);
+
+            threads.emplace_back([&]() {
+                std::mt19937 random(359);
+
+                while (writing.load()) {
+                    int vertex1 = (int)(random() % VERTICES), vertex2 = (int)(random() % VERTICES);
+
+                    reads += graph.areAdjacent(vertex1, vertex2) + graph.areAdjacentById(vertex1, vertex2) +
+                             graph.degreeById(vertex1);
+                }
+            });
+
+            for (int i = 0; i < WRITERS + 1; i++)
+                threads[i].join();
+
+            writing.store(false);
+            threads.back().join();
+
+            std::map<std::pair<int, int>, int> edges;
+            for (const auto& model : models)
+                edges.insert(model.begin(), model.end());
+
+            for (int from = 0; from < VERTICES; from++) {
+                int degree = 0;
+
+                for (int to = 0; to < VERTICES; to++) {
+                    auto it       = edges.find({ from, to });
+                    bool adjacent = it != edges.end() || edges.count({ to, from }) != 0;
+
+                    degree += it != edges.end();
+
+                    check(graph.areAdjacent(from, to) == adjacent &&
+                          (it == edges.end() || graph.weightById(graph.indexOf(from), graph.indexOf(to)) == it->second),
+                          "edge " + std::to_string(from) + " -> " + std::to_string(to) + " after concurrent updates");
+                }
+
+                check(graph.degree(from) == degree, "degree(" + std::to_string(from) + ") after concurrent updates");
+            }
+
+            check(graph.size() == 4 * VERTICES - removedVertices,
+                  "size() after concurrent insertions and removals");
+
+            // removing vertices with edges clears their rows and columns, including self loops
+            for (int vertex = 0; vertex < VERTICES; vertex += 7) {
+                graph.insertEdge(vertex, vertex, 1);
+                graph.removeVertex(vertex);
+
+                for (auto it = edges.begin(); it != edges.end();)
+                    it = it->first.first == vertex || it->first.second == vertex ? edges.erase(it) : std::next(it);
+            }
+
+            for (int from = 0; from < VERTICES; from++) {
+                int degree = 0;
+
+                for (int to = 0; to < VERTICES; to++) {
+                    degree += edges.count({ from, to }) != 0;
+
+                    check(graph.areAdjacent(from, to) == (edges.count({ from, to }) != 0 || edges.count({ to, from }) != 0),
+                          "edge " + std::to_string(from) + " -> " + std::to_string(to) + " after removeVertex");
+                }
+
+                check(graph.degree(from) == (from % 7 == 0 ? -1 : degree),
+                      "degree(" + std::to_string(from) + ") after removeVertex");
+            }
+
+            // a vertex inserted in place of a removed one has no edges left over
+            graph.insertVertex(-1);
+            check(graph.degree(-1) == 0 && !graph.areAdjacent(-1, 1), "vertex inserted at a freed index has no edges");
+        }
+
+        std::cout << "ConcurrentAdjacencyMatrix checked against per-thread reference models" << std::endl << std::endl;
+    }
+
+    void checkFibonacciHeapOperations() {
+        std::mt19937 random(36);
+
+        FibonacciHeap<int, int>                   heap(INT_MIN);
+        std::set<std::pair<int, Node<int, int>*>> model; // (key, node)
+        std::vector<Node<int, int>*>              nodes;
+
+        for (int operation = 0; operation < 50000; operation++) {
+            int kind = (int)(random() % 10);
+
+            if (kind < 4 || model.empty()) {
+                Node<int, int>* node = new Node<int, int>((int)(random() % 100000), operation);
+
+                heap.insert(node);
+                model.insert({ node->key, node });
+                nodes.push_back(node);
+            } else if (kind < 7) {
+                // decreasing a random node makes cuts and cascading cuts inside the trees
+                auto it = std::next(model.begin(), random() % model.size());
+
+                Node<int, int>* node = it->second;
+                int             key  = node->key - (int)(random() % (random() % 2 == 0 ? 10 : 100000));
+
+                model.erase(it);
+                model.insert({ key, node });
+                heap.decreaseKey(node, key);
+            } else if (kind < 9) {
+                Node<int, int>* node = heap.extractMin();
+
+                check(node->key == model.begin()->first, "extractMin() returns a node with the minimum key");
+                model.erase({ node->key, node });
+            } else {
+                auto it = std::next(model.begin(), random() % model.size());
+
+                Node<int, int>* node = it->second;
+
+                model.erase(it);
+                heap.deleteItem(node);
+            }
+
+            check(heap.size() == model.size() && (model.empty() || heap.findMin()->key == model.begin()->first),
+                  "size() and findMin() of FibonacciHeap after operation " + std::to_string(operation));
+        }
+
+        while (!heap.isEmpty())
+            heap.extractMin();
+
+        for (Node<int, int>* node : nodes)
+            delete node;
+    }
+
+    void checkFibonacciHeapUnion() {
+        std::mt19937 random(49);
+
+        for (int round = 0; round < 20; round++) {
+            FibonacciHeap<int, int> heap(INT_MIN);
+            FibonacciHeap<int, int> another(INT_MIN);
+
+            std::vector<std::unique_ptr<Node<int, int>>> nodes;
+            std::multiset<int>                           model;
+
+            for (int i = (int)(random() % 10); i > 0; i--) {
+                nodes.push_back(std::make_unique<Node<int, int>>((int)(random() % 1000), i));
+                (random() % 2 == 0 ? heap : another).insert(nodes.back().get());
+                model.insert(nodes.back()->key);
+            }
+
+            heap.unionWith(another);
+
+            check(heap.size() == model.size() && another.isEmpty(), "unionWith() moves all the nodes");
+
+            for (int key : model)
+                check(heap.extractMin()->key == key, "extractMin() after unionWith()");
+        }
+    }
+
+    void checkPrimEngines() {
+        printTitle("PRIM ENGINES CHECK");
+
+        checkFibonacciHeapOperations();
+        checkFibonacciHeapUnion();
+
+        std::mt19937 random(136);
+
+        for (int round = 0; round < 50; round++) {
+            GraphModel                model = randomGraphModel(random, 60, 1 + round % 5);
+            AdjacencyMatrix<int, int> matrix;
+            AdjacencyList<int, int>   list;
+
+            fillGraph(matrix, model);
+            fillGraph(list, model);
+
+            CSRGraph<int, int> csr = matrix.toCSR();
+
+            for (MsfEngine engine : { MsfEngine::LazyPrim, MsfEngine::EagerPrim }) {
+                std::string name = engine == MsfEngine::LazyPrim ? "lazy Prim" : "eager Prim";
+
+                std::vector<std::pair<int, int>> matrixForest, listForest, csrForest;
+
+                GetMinSpanningForest(matrix, matrixForest, engine);
+                GetMinSpanningForest(list, listForest, engine);
+                GetMinSpanningForest(csr, csrForest, engine);
+
+                checkForest(name + " on AdjacencyMatrix", matrixForest, model);
+                checkForest(name + " on AdjacencyList", listForest, model);
+                checkForest(name + " on CSRGraph", csrForest, model);
+            }
+        }
+
+        std::cout << "FibonacciHeap and both Prim engines checked against Kruskal's algorithm" << std::endl << std::endl;
+    }
+
+    void checkParallelBoruvka() {
+        printTitle("PARALLEL BORUVKA CHECK");
+
+        std::mt19937 random(37);
+
+        for (int round = 0; round < 60; round++) {
+            GraphModel model = randomGraphModel(random, round < 50 ? 60 : 900, 1 + round % 5);
+
+            // few distinct weights make many ties that have to be broken consistently
+            if (round % 2 == 0) {
+                GraphModel tied;
+                tied.vertices = model.vertices;
+
+                for (const auto& edge : model.edges)
+                    if (edge.first.first < edge.first.second)
+                        tied.insertEdge(edge.first.first, edge.first.second, 1 + edge.second % 3);
+
+                model = tied;
+            }
+
+            AdjacencyMatrix<int, int> matrix;
+            AdjacencyList<int, int>   list;
+
+            fillGraph(matrix, model);
+            fillGraph(list, model);
+
+            CSRGraph<int, int> csr = matrix.toCSR();
+
+            for (unsigned threads : { 1u, 2u, 3u, 8u }) {
+                std::string name = "parallel Boruvka on " + std::to_string(threads) + " threads";
+
+                std::vector<std::pair<int, int>> matrixForest, listForest, csrForest;
+
+                GetMinSpanningForest(matrix, matrixForest, MsfEngine::ParallelBoruvka, threads);
+                GetMinSpanningForest(list, listForest, MsfEngine::ParallelBoruvka, threads);
+                GetMinSpanningForest(csr, csrForest, MsfEngine::ParallelBoruvka, threads);
+
+                checkForest(name + " on AdjacencyMatrix", matrixForest, model);
+                checkForest(name + " on AdjacencyList", listForest, model);
+                checkForest(name + " on CSRGraph", csrForest, model);
+            }
+        }
+
+        // every engine takes a directed edge as an undirected one, the lighter of two opposite edges counts
+        for (int round = 0; round < 40; round++) {
+            GraphModel symmetric = randomGraphModel(random, 60, 1 + round % 5);
+            GraphModel directed, undirected;
+
+            directed.vertices = undirected.vertices = symmetric.vertices;
+
+            for (const auto& edge : symmetric.edges) {
+                int from = edge.first.first, to = edge.first.second;
+
+                if (from > to)
+                    continue;
+
+                int kind = (int)(random() % 3);
+                int back = kind == 2 ? 1 + (int)(random() % 1000) : edge.second;
+
+                if (kind != 1)
+                    directed.edges[{ from, to }] = edge.second;
+                if (kind != 0)
+                    directed.edges[{ to, from }] = back;
+
+                undirected.insertEdge(from, to, kind == 2 ? std::min(edge.second, back) : edge.second);
+            }
+
+            AdjacencyMatrix<int, int> matrix;
+            AdjacencyList<int, int>   list;
+
+            fillGraph(matrix, directed);
+            fillGraph(list, directed);
+
+            CSRGraph<int, int> csr = matrix.toCSR();
+
+            for (MsfEngine engine : { MsfEngine::LazyPrim, MsfEngine::EagerPrim, MsfEngine::ParallelBoruvka }) {
+                std::string name = engine == MsfEngine::LazyPrim ? "lazy Prim" : engine == MsfEngine::EagerPrim ?
+                                   "eager Prim" : "parallel Boruvka";
+
+                std::vector<std::pair<int, int>> matrixForest, listForest, csrForest;
+
+                GetMinSpanningForest(matrix, matrixForest, engine, 2);
+                GetMinSpanningForest(list, listForest, engine, 2);
+                GetMinSpanningForest(csr, csrForest, engine, 2);
+
+                checkForest(name + " on asymmetric AdjacencyMatrix", matrixForest, undirected);
+                checkForest(name + " on asymmetric AdjacencyList", listForest, undirected);
+                checkForest(name + " on asymmetric CSRGraph", csrForest, undirected);
+            }
+        }
+
+        std::cout << "parallel Boruvka checked against Kruskal's algorithm on 1 to 8 threads, "
+                  << "all the engines on asymmetric graphs" << std::endl << std::endl;
+    }
+
+    void checkDynamicMinSpanningForest() {
+        printTitle("DYNAMIC MINIMUM SPANNING FOREST CHECK");
+
+        std::mt19937 random(38);
+
+        for (int round = 0; round < 20; round++) {
+            GraphModel                model = randomGraphModel(random, 50, 2);
+            AdjacencyMatrix<int, int> graph;
+
+            fillGraph(graph, model);
+
+            DynamicMinSpanningForest<int, int> dynamicForest(graph);
+
+            for (int operation = 0; operation < 400; operation++) {
+                std::vector<int> list(model.vertices.begin(), model.vertices.end());
+
+                int kind = (int)(random() % 10);
+                int from = list[random() % list.size()];
+                int to   = list[random() % list.size()];
+
+                // few distinct weights make many ties
+                int weight = 1 + (int)(random() % (round % 2 == 0 ? 5 : 1000));
+
+                if (kind < 4) {
+                    graph.insertEdge(from, to, weight);
+                    graph.insertEdge(to, from, weight);
+                    model.insertEdge(from, to, weight);
+                } else if (kind < 5) {
+                    graph.insertEdge(from, to, weight); // one direction only or a new weight of one direction
+                    model.edges[{ from, to }] = weight;
+                } else if (kind < 8 && !model.edges.empty()) {
+                    auto edge = std::next(model.edges.begin(), random() % model.edges.size())->first;
+
+                    graph.removeEdge(edge.first, edge.second);
+                    model.edges.erase(edge);
+                } else if (kind < 9 && list.size() > 1) {
+                    graph.removeVertex(from);
+                    model.removeVertex(from);
+
+                    graph.insertVertex(from); // vertex comes back without edges
+                    model.vertices.insert(from);
+                } else {
+                    graph.compact(); // indexes change, the forest follows vertices
+                }
+
+                for (auto it = model.edges.begin(); it != model.edges.end(); )
+                    it = it->first.first == it->first.second ? model.edges.erase(it) : std::next(it);
+
+                std::vector<std::pair<int, int>> forest;
+                dynamicForest.getForest(forest);
+
+                checkForest("dynamic forest after operation " + std::to_string(operation), forest, model);
+                check(dynamicForest.size() == forest.size(), "size() of DynamicMinSpanningForest");
+                check(dynamicForest.numberOfVertices() <= model.vertices.size(),
+                      "DynamicMinSpanningForest keeps nodes of removed vertices");
+            }
+        }
+
+        // a long path is cut in the middle again and again, the replacement is the only edge between the halves
+        AdjacencyMatrix<int, int>          path;
+        DynamicMinSpanningForest<int, int> pathForest(path);
+
+        const int LENGTH = 2000;
+
+        for (int i = 0; i < LENGTH; i++)
+            path.insertVertex(i);
+        for (int i = 0; i + 1 < LENGTH; i++)
+            path.insertEdge(i, i + 1, 1);
+
+        path.insertEdge(0, LENGTH - 1, 5);
+
+        for (int round = 0; round < 200; round++) {
+            int middle = (int)(random() % (LENGTH - 1));
+
+            path.removeEdge(middle, middle + 1);
+            check(pathForest.size() == LENGTH - 1, "the cut path is reconnected by the edge between its ends");
+
+            path.insertEdge(middle, middle + 1, 1);
+            check(pathForest.size() == LENGTH - 1, "the restored edge replaces the heavier one");
+        }
+
+        std::vector<std::pair<int, int>> pathEdges;
+        pathForest.getForest(pathEdges);
+
+        check(std::find(pathEdges.begin(), pathEdges.end(), std::make_pair(0, LENGTH - 1)) == pathEdges.end(),
+              "the heavy edge leaves the forest when the path is restored");
+
+        // vertices come and go, their nodes are freed
+        for (int i = 0; i < 10 * LENGTH; i++) {
+            path.insertVertex(LENGTH + i);
+            path.insertEdge(LENGTH + i, i % LENGTH, 1);
+            path.removeVertex(LENGTH + i);
+        }
+
+        check(pathForest.numberOfVertices() == LENGTH && pathForest.size() == LENGTH - 1,
+              "DynamicMinSpanningForest frees nodes of removed vertices");
+
+        std::cout << "DynamicMinSpanningForest checked against Kruskal's algorithm after every change" << std::endl << std::endl;
+    }
+
+    /**
+     * @brief checkPath checks that the path goes from the source to the target along edges of the graph
+     *        and that its length is the expected distance
+     */
+    void checkPath(const std::string& name, const std::vector<int>& path, const AdjacencyMatrix<int, int>& graph,
+                   int source, int target, long long expected)
+    {
+        long long length = 0;
+        bool      valid  = !path.empty() && path.front() == source && path.back() == target;
+
+        for (size_t i = 0; valid && i + 1 < path.size(); i++) {
+            valid   = graph.hasEdge(path[i], path[i + 1]);
+            length += valid ? graph.weight(path[i], path[i + 1]) : 0;
+        }
+
+        check(valid && length == expected, name + " path from " + std::to_string(source) + " to " + std::to_string(target));
+    }
+
+    void checkShortestPaths() {
+        printTitle("SHORTEST PATHS CHECK");
+
+        std::mt19937 random(39);
+
+        for (int round = 0; round < 30; round++) {
+            AdjacencyMatrix<int, int>                graph;
+            ShortestPaths<AdjacencyMatrix<int, int>> paths(graph);
+
+            std::vector<int> vertices;
+
+            // the engine keeps its state between the phases while the graph grows
+            for (int phase = 0; phase < 2; phase++) {
+                for (int i = (int)(1 + random() % 40); i > 0; i--) {
+                    int vertex = (int)(random() % 1000);
+
+                    if (!graph.vertexExist(vertex)) {
+                        graph.insertVertex(vertex);
+                        vertices.push_back(vertex);
+                    }
+                }
+
+                // weights are not less than the distance between the numbers of vertices, so the heuristic is consistent
+                for (int i = (int)(random() % (3 * vertices.size() + 1)); i > 0; i--) {
+                    int from = vertices[random() % vertices.size()];
+                    int to   = vertices[random() % vertices.size()];
+
+                    graph.insertEdge(from, to, std::abs(from - to) + (int)(random() % 50));
+                }
+
+                int n = graph.indexCount();
+
+                const long long UNREACHABLE = LLONG_MAX / 4;
+                std::vector<std::vector<long long>> reference(n, std::vector<long long>(n, UNREACHABLE));
+
+                for (int i = 0; i < n; i++) {
+                    reference[i][i] = 0;
+                    graph.forEachNeighbor(i, [&](int to, const int& weight) {
+                        reference[i][to] = std::min(reference[i][to], (long long)weight);
+                    });
+                }
+
+                for (int k = 0; k < n; k++)
+                    for (int i = 0; i < n; i++)
+                        for (int j = 0; j < n; j++)
+                            reference[i][j] = std::min(reference[i][j], reference[i][k] + reference[k][j]);
+
+                auto expected = [&](int source, int target) {
+                    return reference[source][target] == UNREACHABLE ? ShortestPaths<AdjacencyMatrix<int, int>>::INFINITY_DISTANCE
+                                                                    : (double)reference[source][target];
+                };
+
+                for (int source = 0; source < n; source++) {
+                    paths.dijkstra(source);
+
+                    for (int target = 0; target < n; target++) {
+                        check(paths.distance(target) == expected(source, target), "single source dijkstra distance");
+
+                        if (reference[source][target] != UNREACHABLE)
+                            checkPath("single source dijkstra", paths.path(target), graph, source, target,
+                                      reference[source][target]);
+                    }
+                }
+
+                for (int query = 0; query < 200; query++) {
+                    int source = (int)(random() % n);
+                    int target = (int)(random() % n);
+
+                    auto heuristic = [&](int index) { return (double)std::abs(graph.vertexAt(index) - graph.vertexAt(target)); };
+
+                    double dijkstra      = paths.dijkstra(source, target);
+                    auto   dijkstraPath  = paths.path(target);
+                    double aStar         = paths.aStar(source, target, heuristic);
+                    auto   aStarPath     = paths.path(target);
+                    double bidirectional = paths.bidirectional(source, target);
+                    auto   bothWaysPath  = paths.path(target);
+
+                    check(dijkstra == expected(source, target), "point-to-point dijkstra distance");
+                    check(aStar == expected(source, target), "A* distance");
+                    check(bidirectional == expected(source, target), "bidirectional dijkstra distance");
+
+                    if (reference[source][target] != UNREACHABLE) {
+                        checkPath("point-to-point dijkstra", dijkstraPath, graph, source, target, reference[source][target]);
+                        checkPath("A*", aStarPath, graph, source, target, reference[source][target]);
+                        checkPath("bidirectional dijkstra", bothWaysPath, graph, source, target, reference[source][target]);
+                    } else {
+                        check(dijkstraPath.empty() && aStarPath.empty() && bothWaysPath.empty(),
+                              "no path to an unreachable vertex");
+                    }
+                }
+            }
+        }
+
+        std::cout << "Dijkstra, bidirectional Dijkstra and A* checked against Floyd-Warshall" << std::endl << std::endl;
+    }
+
+    /**
+     * @brief The SortItem struct is a key with the position it had before sorting, so stability can be checked
+     */
+    struct SortItem {
+        int key;
+        int position;
+
+        friend bool operator < (const SortItem& item1, const SortItem& item2) {
+            return item1.key < item2.key;
+        }
+
+        friend bool operator == (const SortItem& item1, const SortItem& item2) {
+            return item1.key == item2.key && item1.position == item2.position;
+        }
+    };
+
+    std::vector<SortItem> randomSortItems(std::mt19937& random, size_t size, int keys) {
+        std::vector<SortItem> items(size);
+
+        for (size_t i = 0; i < size; i++)
+            items[i] = { (int)(random() % keys), (int)i };
+
+        return items;
+    }
+
+    void checkParallelMergeSort() {
+        printTitle("PARALLEL MERGE SORT CHECK");
+
+        std::mt19937 random(40);
+
+        for (size_t size : { 0, 1, 2, 3, 100, 1000, 10000, 100000 }) {
+            std::vector<SortItem> items = randomSortItems(random, size, 1 + (int)(size / 8));
+            std::vector<SortItem> expected = items;
+
+            std::stable_sort(expected.begin(), expected.end());
+
+            std::vector<SortItem> sequential = items;
+            mergeSort(sequential);
+
+            check(sequential == expected, "mergeSort of " + std::to_string(size) + " elements");
+
+            for (unsigned threads : { 1u, 2u, 3u, 8u }) {
+                std::vector<SortItem> parallel = items;
+                parallelMergeSort(parallel, threads);
+
+                check(parallel == expected,
+                      "parallelMergeSort of " + std::to_string(size) + " elements on " + std::to_string(threads) + " threads");
+            }
+        }
+
+        // one pool sorts many vectors of different sizes
+        ThreadPool pool(4);
+
+        for (int round = 0; round < 50; round++) {
+            std::vector<SortItem> items    = randomSortItems(random, random() % 50000, 1 + (int)(random() % 1000));
+            std::vector<SortItem> expected = items;
+
+            std::stable_sort(expected.begin(), expected.end());
+            parallelMergeSort(items, pool);
+
+            check(items == expected, "parallelMergeSort on a shared pool");
+        }
+
+        std::cout << "mergeSort and parallelMergeSort checked against std::stable_sort" << std::endl << std::endl;
+    }
+
+    /**
+     * @brief The MoveOnlyItem struct can be moved but not copied, so sorting it checks that elements are never copied
+     */
+    struct MoveOnlyItem {
+        std::unique_ptr<SortItem> item;
+
+        friend bool operator < (const MoveOnlyItem& item1, const MoveOnlyItem& item2) {
+            return *item1.item < *item2.item;
+        }
+    };
+
+    void checkAdaptiveMergeSort() {
+        printTitle("ADAPTIVE MERGE SORT CHECK");
+
+        std::mt19937 random(41);
+
+        for (int round = 0; round < 200; round++) {
+            size_t size = round < 100 ? random() % 100 : random() % 100000;
+
+            std::vector<SortItem> items = randomSortItems(random, size, 1 + (int)(random() % (size + 1)));
+
+            switch (round % 5) {
+            case 0: // sorted
+                std::stable_sort(items.begin(), items.end());
+                break;
+            case 1: // reversed
+                std::stable_sort(items.begin(), items.end());
+                std::reverse(items.begin(), items.end());
+                break;
+            case 2: // appended time series: sorted with a few elements out of place
+                std::stable_sort(items.begin(), items.end());
+                for (size_t i = size / 100 + 1; i > 0 && size > 1; i--)
+                    std::swap(items[random() % size], items[random() % size]);
+                break;
+            case 3: // several sorted blocks
+                for (size_t begin = 0; begin < size; begin += 1 + random() % 5000)
+                    std::sort(items.begin() + begin, items.begin() + std::min(size, begin + 1 + random() % 5000));
+                break;
+            default: // random
+                break;
+            }
+
+            for (size_t i = 0; i < size; i++)
+                items[i].position = (int)i;
+
+            std::vector<SortItem> expected = items;
+            std::stable_sort(expected.begin(), expected.end());
+
+            adaptiveMergeSort(items);
+
+            check(items == expected, "adaptiveMergeSort of " + std::to_string(size) + " elements, case " +
+                                     std::to_string(round % 5));
+        }
+
+        std::vector<MoveOnlyItem> moveOnly(10000);
+        for (size_t i = 0; i < moveOnly.size(); i++)
+            moveOnly[i].item.reset(new SortItem{ (int)(random() % 100), (int)i });
+
+        adaptiveMergeSort(moveOnly);
+
+        check(std::is_sorted(moveOnly.begin(), moveOnly.end(), [](const MoveOnlyItem& a, const MoveOnlyItem& b) {
+                  return a.item->key < b.item->key || (a.item->key == b.item->key && a.item->position < b.item->position);
+              }), "adaptiveMergeSort of move-only elements");
+
+        std::cout << "adaptiveMergeSort checked against std::stable_sort on sorted, reversed, nearly sorted and random data"
+                  << std::endl << std::endl;
+    }
+
+    /**
+     * @brief sameBits is true if two vectors hold the same elements bit for bit, so -0.0 differs from 0.0
+     *        and NaNs are equal to themselves
+     */
+    template <typename T>
+    bool sameBits(const std::vector<T>& vector1, const std::vector<T>& vector2) {
+        return vector1.size() == vector2.size() &&
+               (vector1.empty() || std::memcmp(vector1.data(), vector2.data(), vector1.size() * sizeof(T)) == 0);
+    }
+
+    template <typename T>
+    bool isNaN(const T& value) {
+        if constexpr (std::is_floating_point<T>::value)
+            return value != value;
+        else
+            return false;
+    }
+
+    template <typename T>
+    void checkSimdSortOf(const std::string& name, const std::vector<T>& values) {
+        std::vector<T> expected = values;
+        auto           numbers  = std::stable_partition(expected.begin(), expected.end(), [](const T& value) { return !isNaN(value); });
+        std::stable_sort(expected.begin(), numbers);
+
+        std::vector<T> sorted = values;
+        simdSort(sorted);
+
+        check(sameBits(sorted, expected), "simdSort of " + std::to_string(values.size()) + " " + name);
+
+        sorted = values;
+        mergeSort(sorted, SortEngine::Simd);
+
+        check(sameBits(sorted, expected), "mergeSort with SortEngine::Simd of " + std::to_string(values.size()) + " " + name);
+
+        sorted = values;
+        mergeSort(sorted);
+
+        if (numbers == expected.end()) {
+            check(sameBits(sorted, expected), "mergeSort of " + std::to_string(values.size()) + " " + name);
+        } else {
+            // NaNs do not compare, so only the elements themselves are the same as after a stable sort
+            auto byBits = [](const T& value1, const T& value2) { return std::memcmp(&value1, &value2, sizeof(T)) < 0; };
+
+            std::sort(sorted.begin(), sorted.end(), byBits);
+            std::sort(expected.begin(), expected.end(), byBits);
+
+            check(sameBits(sorted, expected), "mergeSort keeps all of " + std::to_string(values.size()) + " " + name);
+        }
+    }
+
+    template <typename T, typename G>
+    void checkSimdSortOf(const std::string& name, std::mt19937& random, G generate) {
+        for (int round = 0; round < 60; round++) {
+            size_t size = round < 40 ? random() % 70 : random() % 50000;
+
+            std::vector<T> values(size);
+            for (T& value : values)
+                value = generate();
+
+            checkSimdSortOf(name, values);
+        }
+    }
+
+    void checkSimdSort() {
+        printTitle("SIMD SORT CHECK");
+
+        std::mt19937 random(42);
+
+        checkSimdSortOf<int>("ints", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? INT_MAX : kind == 1 ? INT_MIN : (int)random() % (kind < 10 ? 100 : INT_MAX);
+        });
+
+        checkSimdSortOf<long long>("long longs", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? LLONG_MAX : kind == 1 ? LLONG_MIN : ((long long)random() << 32 | random()) % (kind < 10 ? 100 : LLONG_MAX);
+        });
+
+        checkSimdSortOf<float>("floats", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? std::numeric_limits<float>::infinity() : kind == 1 ? -std::numeric_limits<float>::infinity() :
+                   (float)((int)(random() % 2001) - 1000) / (kind < 10 ? 1 : 7);
+        });
+
+        checkSimdSortOf<double>("doubles", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? std::numeric_limits<double>::max() : kind == 1 ? std::numeric_limits<double>::lowest() :
+                   (double)((int)(random() % 2001) - 1000) / (kind < 10 ? 1 : 7);
+        });
+
+        checkSimdSortOf<float>("floats with NaNs and signed zeros", random, [&]() {
+            int kind = (int)(random() % 10);
+            return kind == 0 ? std::numeric_limits<float>::quiet_NaN() : kind == 1 ? -0.0f : kind == 2 ? 0.0f :
+                   (float)((int)(random() % 21) - 10);
+        });
+
+        checkSimdSortOf<double>("doubles with NaNs and signed zeros", random, [&]() {
+            int kind = (int)(random() % 10);
+            return kind == 0 ? -std::numeric_limits<double>::quiet_NaN() : kind == 1 ? -0.0 : kind == 2 ? 0.0 :
+                   (double)((int)(random() % 21) - 10);
+        });
+
+        double nan = std::numeric_limits<double>::quiet_NaN();
+
+        checkSimdSortOf<double>("doubles with a NaN", { 3, nan, 1, 2, 7, 4, 6, 5, 9 });
+        checkSimdSortOf<double>("signed zeros", { 0.0, -0.0, 0.0, -0.0, -1, -0.0, 0.0, 0.0, 1, -0.0 });
+        checkSimdSortOf<float>("NaNs", std::vector<float>(3, std::numeric_limits<float>::quiet_NaN()));
+
+        checkSimdSortOf<Date>("dates", random, [&]() {
+            return Date(1900 + (int)(random() % 200), 1 + (int)(random() % 12), 1 + (int)(random() % 28));
+        });
+
+        std::cout << "simdSort and mergeSort of primitive keys, NaNs and signed zeros checked against std::stable_sort"
+                  << std::endl << std::endl;
+    }
+
+    void checkExternalMergeSort() {
+        printTitle("EXTERNAL MERGE SORT CHECK");
+
+        std::mt19937 random(43);
+
+        for (int round = 0; round < 60; round++) {
+            size_t size = round < 20 ? random() % 300 : random() % 50000;
+
+            std::vector<SortItem> items = randomSortItems(random, size, 1 + (int)(random() % (size + 1)));
+
+            std::vector<SortItem> expected = items;
+            std::stable_sort(expected.begin(), expected.end());
+
+            // budgets of 32 to 2048 elements and blocks of 4 to 64 elements make many runs and several merge passes
+            ExternalMergeSort<SortItem> sort(sizeof(SortItem) << (5 + random() % 7), ".", sizeof(SortItem) << (2 + random() % 5));
+
+            for (const SortItem& item : items)
+                sort.push(item);
+
+            std::vector<SortItem> sorted;
+            sort.finish([&](const SortItem* data, size_t count) { sorted.insert(sorted.end(), data, data + count); });
+
+            check(sorted == expected, "ExternalMergeSort of " + std::to_string(size) + " elements");
+            check(sort.statistics().elements == size, "number of elements in statistics of ExternalMergeSort");
+        }
+
+        const std::string path = "checker_external_sort.bin";
+
+        std::vector<SortItem> items = randomSortItems(random, 20000, 1000);
+
+        std::vector<SortItem> expected = items;
+        std::stable_sort(expected.begin(), expected.end());
+
+        ExternalMergeSort<SortItem> sort(4096, ".", 256);
+
+        for (int repeat = 0; repeat < 2; repeat++) {
+            for (const SortItem& item : items)
+                sort.push(item);
+
+            sort.finish(path);
+
+            std::ifstream         file(path, std::ios::binary);
+            std::vector<SortItem> sorted(items.size() + 1);
+
+            file.read(reinterpret_cast<char*>(sorted.data()), sorted.size() * sizeof(SortItem));
+            sorted.resize(file.gcount() / sizeof(SortItem));
+
+            check(sorted == expected, "ExternalMergeSort into a file, sort number " + std::to_string(repeat + 1));
+        }
+
+        check(sort.statistics().mergePasses > 2, "ExternalMergeSort with a small budget merges in several passes");
+
+        std::remove(path.c_str());
+
+        std::cout << "ExternalMergeSort checked against std::stable_sort" << std::endl << std::endl;
+    }
+
+    template <typename T, typename G>
+    void checkRadixSortOf(const std::string& name, std::mt19937& random, G generate) {
+        for (int round = 0; round < 30; round++) {
+            size_t size = round < 20 ? random() % 300 : random() % 50000;
+
+            std::vector<T> values(size);
+            for (T& value : values)
+                value = generate();
+
+            std::vector<T> expected = values;
+            std::stable_sort(expected.begin(), expected.end());
+
+            std::vector<T> sorted = values;
+            radixSort(sorted);
+
+            check(sorted == expected, "radixSort of " + std::to_string(size) + " " + name);
+
+            mergeSort(values, SortEngine::RadixSort);
+
+            check(values == expected, "mergeSort with SortEngine::RadixSort of " + std::to_string(size) + " " + name);
+        }
+    }
+
+    /**
+     * @brief checkRadixSortOfFloats checks that equal zeros keep their order and NaNs go to the end in their order,
+     *        the same result as the one of simdSort
+     */
+    template <typename T>
+    void checkRadixSortOfFloats(const std::string& name, const std::vector<T>& values) {
+        std::vector<T> expected = values;
+        auto           numbers  = std::stable_partition(expected.begin(), expected.end(), [](const T& value) { return !isNaN(value); });
+        std::stable_sort(expected.begin(), numbers);
+
+        std::vector<T> sorted = values;
+        radixSort(sorted);
+
+        check(sameBits(sorted, expected), "radixSort of " + std::to_string(values.size()) + " " + name);
+
+        sorted = values;
+        mergeSort(sorted, SortEngine::RadixSort);
+
+        check(sameBits(sorted, expected), "mergeSort with SortEngine::RadixSort of " + std::to_string(values.size()) + " " + name);
+    }
+
+    void checkRadixSort() {
+        printTitle("RADIX SORT CHECK");
+
+        std::mt19937 random(44);
+
+        checkRadixSortOf<int>("ints", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? INT_MAX : kind == 1 ? INT_MIN : (int)random() % (kind < 10 ? 100 : INT_MAX);
+        });
+
+        checkRadixSortOf<unsigned>("unsigned ints", random, [&]() { return (unsigned)random() >> (random() % 32); });
+
+        checkRadixSortOf<short>("shorts", random, [&]() { return (short)random(); });
+
+        checkRadixSortOf<long long>("long longs", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? LLONG_MAX : kind == 1 ? LLONG_MIN : ((long long)random() << 32 | random()) % (kind < 10 ? 100 : LLONG_MAX);
+        });
+
+        checkRadixSortOf<float>("floats", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? std::numeric_limits<float>::infinity() : kind == 1 ? -std::numeric_limits<float>::infinity() :
+                   (float)((int)(random() % 2001) - 1000) / (kind < 10 ? 1 : 7);
+        });
+
+        checkRadixSortOf<double>("doubles", random, [&]() {
+            int kind = (int)(random() % 20);
+            return kind == 0 ? std::numeric_limits<double>::max() : kind == 1 ? std::numeric_limits<double>::lowest() :
+                   (double)((int)(random() % 2001) - 1000) / (kind < 10 ? 1 : 7) * 1e-300;
+        });
+
+        checkRadixSortOf<Date>("dates", random, [&]() {
+            return Date(1900 + (int)(random() % 200), 1 + (int)(random() % 12), 1 + (int)(random() % 28));
+        });
+
+        double nan  = std::numeric_limits<double>::quiet_NaN();
+        float  nanf = std::numeric_limits<float>::quiet_NaN();
+
+        checkRadixSortOfFloats<double>("signed zeros", { 0.0, -0.0, 0.0, -0.0 });
+        checkRadixSortOfFloats<float>("signed zeros", { -0.0f, 1, 0.0f, -1, -0.0f, 0.0f, 0.0f, -0.0f });
+        checkRadixSortOfFloats<double>("doubles with NaNs", { 3, nan, 1, -nan, 2, -std::numeric_limits<double>::infinity(), nan });
+        checkRadixSortOfFloats<float>("NaNs", std::vector<float>(3, nanf));
+
+        for (int round = 0; round < 30; round++) {
+            size_t size = random() % 5000;
+
+            std::vector<double> doubles(size);
+            std::vector<float>  floats(size);
+
+            for (size_t i = 0; i < size; i++) {
+                int kind = (int)(random() % 10);
+
+                doubles[i] = kind == 0 ? (random() % 2 ? nan : -nan) : kind == 1 ? -0.0 : kind == 2 ? 0.0 : (double)((int)(random() % 21) - 10);
+                floats[i]  = (float)doubles[i];
+            }
+
+            checkRadixSortOfFloats(std::string("doubles with NaNs and signed zeros"), doubles);
+            checkRadixSortOfFloats(std::string("floats with NaNs and signed zeros"), floats);
+        }
+
+        for (int round = 0; round < 30; round++) {
+            size_t size = random() % 20000;
+
+            std::vector<SortItem> items = randomSortItems(random, size, 1 + (int)(random() % (size + 1)));
+            for (SortItem& item : items)
+                item.key -= (int)size / 2;
+
+            std::vector<SortItem> expected = items;
+            std::stable_sort(expected.begin(), expected.end());
+
+            radixSort(items, [](const SortItem& item) { return item.key; });
+
+            check(items == expected, "radixSort with a key function of " + std::to_string(size) + " elements is stable");
+        }
+
+        std::cout << "radixSort checked against std::stable_sort, signed zeros and NaNs against simdSort" << std::endl << std::endl;
+    }
+
+    struct HeavyRecord {
+        Date date;
+        int  position;
+        char payload[244];
+
+        bool operator == (const HeavyRecord& record) const {
+            return date == record.date && position == record.position &&
+                   std::memcmp(payload, record.payload, sizeof(payload)) == 0;
+        }
+    };
+
+    std::vector<HeavyRecord> randomHeavyRecords(std::mt19937& random, size_t size) {
+        std::vector<HeavyRecord> records(size);
+
+        for (size_t i = 0; i < size; i++) {
+            records[i].date     = Date(2000 + (int)(random() % 20), 1 + (int)(random() % 12), 1 + (int)(random() % 28));
+            records[i].position = (int)i;
+            std::memset(records[i].payload, (int)(i % 256), sizeof(records[i].payload));
+        }
+
+        return records;
+    }
+
+    void checkKeyProjectionSort() {
+        printTitle("KEY PROJECTION AND INDIRECT SORT CHECK");
+
+        std::mt19937 random(45);
+
+        auto byDate = [](const HeavyRecord& record1, const HeavyRecord& record2) { return record1.date < record2.date; };
+        auto byDateDescending = [](const HeavyRecord& record1, const HeavyRecord& record2) { return record2.date < record1.date; };
+
+        for (int round = 0; round < 40; round++) {
+            size_t size = round < 20 ? random() % 100 : random() % 5000;
+
+            std::vector<HeavyRecord> records = randomHeavyRecords(random, size);
+
+            std::vector<HeavyRecord> expected = records;
+            std::stable_sort(expected.begin(), expected.end(), byDate);
+
+            std::vector<HeavyRecord> sorted = records;
+            mergeSort(sorted.begin(), sorted.end(), std::less<>(), &HeavyRecord::date);
+            check(sorted == expected, "mergeSort of " + std::to_string(size) + " records by a member");
+
+            sorted = records;
+            indirectSort(sorted.begin(), sorted.end(), std::less<>(), &HeavyRecord::date);
+            check(sorted == expected, "indirectSort of " + std::to_string(size) + " records by a member");
+
+            std::vector<size_t> order = argsort(records.begin(), records.end(), std::less<>(), &HeavyRecord::date);
+            bool isExpectedOrder = order.size() == size;
+            for (size_t i = 0; i < order.size() && isExpectedOrder; i++)
+                isExpectedOrder = records[order[i]] == expected[i];
+            check(isExpectedOrder, "argsort of " + std::to_string(size) + " records");
+
+            std::stable_sort(expected.begin(), expected.end(), byDateDescending);
+
+            sorted = records;
+            indirectSort(sorted.begin(), sorted.end(), std::greater<>(), [](const HeavyRecord& record) { return record.date; });
+            check(sorted == expected, "indirectSort of " + std::to_string(size) + " records by a comparator");
+
+            sorted = records;
+            mergeSort(sorted.begin(), sorted.end(), byDateDescending);
+            check(sorted == expected, "mergeSort of " + std::to_string(size) + " records by a comparator");
+        }
+
+        std::vector<std::string> words;
+        for (int i = 0; i < 3000; i++)
+            words.push_back(std::to_string(random() % 1000));
+
+        std::vector<std::string> expected = words;
+        std::stable_sort(expected.begin(), expected.end(), [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+
+        std::vector<std::string> sorted = words;
+        indirectSort(sorted.begin(), sorted.end(), std::less<>(), [](const std::string& word) { return word.size(); });
+        check(sorted == expected, "indirectSort of strings by their lengths");
+
+        sorted = words;
+        std::sort(expected.begin(), expected.end());
+        mergeSort(sorted.begin(), sorted.end());
+        check(sorted == expected, "mergeSort of a range of strings");
+
+        // std::less does not tell -0.0 from 0.0, so they keep their order as any other equal keys
+        std::vector<double> zeros = { 0.0, -0.0, 1.0, 0.0, -1.0, -0.0, 0.0, -0.0 };
+        std::vector<size_t> stableOrder = { 4, 0, 1, 3, 5, 6, 7, 2 };
+
+        check(argsort(zeros.begin(), zeros.end()) == stableOrder, "argsort of signed zeros");
+        check(argsort(zeros.begin(), zeros.end(), [](double a, double b) { return a < b; }) == stableOrder,
+              "argsort of signed zeros by a comparator");
+
+        std::cout << "mergeSort of ranges, argsort and indirectSort checked against std::stable_sort" << std::endl << std::endl;
+    }
+
+    void checkDateParser() {
+        printTitle("DATE PARSER CHECK");
+
+        std::mt19937 random(46);
+
+        const std::vector<std::string> malformedDates = {
+            "2021-02-29", "1900-02-29", "2020-13-01", "2020-00-10", "2020-04-31", "2020-01-00",
+            "2020/01/01", "20x0-01-01", "2020-1-012", " 2020-01-0", "2020-01-1:"
+        };
+
+        check(Date::GetDateFromString("2000-02-29") == Date(2000, 2, 29), "GetDateFromString of a leap day");
+
+        // GetDateFromString keeps reading the fields as std::stoi does, only TryParse and parseDates are strict
+        const std::vector<std::pair<std::string, Date>> lenientDates = {
+            { "2022-03-5", Date(2022, 3, 5) }, { "2022-03-05T10:00", Date(2022, 3, 5) },
+            { "2021-02-29", Date(2021, 3, 1) }, { "2020-04-31", Date(2020, 5, 1) }, { "2020/01/01", Date(2020, 1, 1) },
+            { "2020-1-012", Date(2020, 1, 12) }, { " 202-01-0 ", Date(202, 1, 0) }, { "2020-01-+7", Date(2020, 1, 7) }
+        };
+
+        for (const auto& lenient : lenientDates) {
+            Date date;
+
+            check(Date::GetDateFromString(lenient.first) == lenient.second && !Date::TryParse(lenient.first, date),
+                  "GetDateFromString of " + lenient.first + " reads the fields leniently");
+        }
+
+        for (const std::string& text : malformedDates) {
+            Date date(1970, 1, 1);
+
+            check(!Date::TryParse(text, date) && date == Date(1970, 1, 1), "TryParse of " + text + " fails");
+        }
+
+        for (const std::string& text : { "", "2020-01", "2020-01-", "abcd-01-01", "2020-xx-01", "2020-01-x1" }) {
+            bool thrown = false;
+
+            try {
+                Date::GetDateFromString(text);
+            } catch (const std::invalid_argument&) {
+                thrown = true;
+            }
+
+            check(thrown, "GetDateFromString of \"" + std::string(text) + "\" throws std::invalid_argument");
+        }
+
+        bool isOutOfRange = false;
+
+        try {
+            Date::GetDateFromString("2020-01-99999999999");
+        } catch (const std::out_of_range&) {
+            isOutOfRange = true;
+        }
+
+        check(isOutOfRange, "GetDateFromString of a day beyond int throws std::out_of_range");
+
+        for (size_t stride : { 10, 11, 16, 23 }) {
+            for (int round = 0; round < 20; round++) {
+                size_t count = random() % 300;
+
+                std::string       buffer(count * stride, '\n');
+                std::vector<Date> expected(count, Date(1970, 1, 1));
+                std::vector<bool> isMalformed(count, false);
+
+                for (size_t row = 0; row < count; row++) {
+                    std::string text;
+
+                    if (random() % 10 == 0) {
+                        text             = malformedDates[random() % malformedDates.size()];
+                        isMalformed[row] = true;
+                    } else {
+                        int year  = (int)(random() % 10000);
+                        int month = 1 + (int)(random() % 12);
+                        int day   = 1 + (int)(random() % 31);
+
+                        while (!Date::IsValid(year, month, day))
+                            day--;
+
+                        char formatted[40];
+                        std::snprintf(formatted, sizeof(formatted), "%04d-%02d-%02d", year, month, day);
+
+                        text          = formatted;
+                        expected[row] = Date(year, month, day);
+                    }
+
+                    buffer.replace(row * stride, text.size(), text);
+                }
+
+                buffer.resize(count == 0 ? 0 : (count - 1) * stride + 10);
+
+                std::vector<Date>   dates(count, Date(1970, 1, 1));
+                std::vector<size_t> reported;
+
+                size_t malformed = parseDates(buffer.data(), count, stride, dates.data(),
+                                              [&](size_t row) { reported.push_back(row); });
+
+                std::vector<size_t> expectedReported;
+                for (size_t row = 0; row < count; row++)
+                    if (isMalformed[row])
+                        expectedReported.push_back(row);
+
+                check(dates == expected, "parseDates of " + std::to_string(count) + " rows with stride " + std::to_string(stride));
+                check(reported == expectedReported && malformed == reported.size(),
+                      "malformed rows reported by parseDates with stride " + std::to_string(stride));
+            }
+        }
+
+        std::cout << "parseDates and Date::TryParse checked against formatted dates" << std::endl << std::endl;
+    }
+
+    void checkDateCalendar() {
+        printTitle("DATE CALENDAR CHECK");
+
+        static_assert(Date(2000, 1, 1).date == 2451545, "Date(2000, 1, 1) is folded at compile time");
+        static_assert(Date(2024, 3, 31).addMonths(-1) == Date(2024, 2, 29), "addMonths is folded at compile time");
+        static_assert(Date::FromJulianDay(2451545).year() == 2000, "decode is folded at compile time");
+
+        // every day of four centuries in a row
+        int year = 1600, month = 1, day = 1;
+        bool isDecoded = true;
+
+        for (Date date(1600, 1, 1); date < Date(2000, 1, 1); date.increaseDay()) {
+            int decodedYear = 0, decodedMonth = 0, decodedDay = 0;
+            date.decode(decodedYear, decodedMonth, decodedDay);
+
+            isDecoded = isDecoded && decodedYear == year && decodedMonth == month && decodedDay == day;
+
+            if (++day > Date::DaysInMonth(year, month)) {
+                day = 1;
+
+                if (++month > 12) {
+                    month = 1;
+                    year++;
+                }
+            }
+        }
+
+        check(isDecoded, "decode of every day from 1600 to 2000");
+
+        std::mt19937 random(47);
+
+        std::vector<Date>        dates;
+        std::vector<std::string> expected;
+
+        for (int i = 0; i < 2000; i++) {
+            int y = (int)(random() % 10000), m = 1 + (int)(random() % 12), d = 1 + (int)(random() % Date::DaysInMonth(y, m));
+
+            Date date(y, m, d);
+
+            char formatted[40];
+            std::snprintf(formatted, sizeof(formatted), "%04d-%02d-%02d", y, m, d);
+
+            check(date.year() == y && date.month() == m && date.day() == d, std::string("year, month and day of ") + formatted);
+            check(date.toString() == formatted, std::string("toString of ") + formatted);
+
+            check(date.startOfMonth() == Date(y, m, 1), std::string("startOfMonth of ") + formatted);
+            check(date.startOfWeek().dayOfWeek() == 0 && date.startOfWeek() <= date && date.date - date.startOfWeek().date < 7,
+                  std::string("startOfWeek of ") + formatted);
+            check(date.monthBucket() == date.startOfMonth().monthBucket() &&
+                  date.startOfMonth().addDays(-1).monthBucket() == date.monthBucket() - 1, std::string("monthBucket of ") + formatted);
+            check(date.weekBucket() == date.startOfWeek().weekBucket() &&
+                  date.startOfWeek().addDays(-1).weekBucket() == date.weekBucket() - 1, std::string("weekBucket of ") + formatted);
+
+            dates.push_back(date);
+            expected.push_back(formatted);
+        }
+
+        check(Date(2026, 10, 18).dayOfWeek() == 6 && Date(2000, 1, 1).dayOfWeek() == 5, "dayOfWeek of known dates");
+        check(Date(2023, 1, 31).addMonths(1) == Date(2023, 2, 28) && Date(2023, 1, 15).addMonths(-13) == Date(2021, 12, 15),
+              "addMonths clamps the day and crosses years");
+
+        std::string buffer(dates.size() * 11, '\n');
+        formatDates(dates.data(), dates.size(), &buffer[0], 11);
+
+        bool isFormatted = true;
+        for (size_t i = 0; i < dates.size(); i++)
+            isFormatted = isFormatted && buffer.compare(i * 11, 11, expected[i] + "\n") == 0;
+
+        check(isFormatted, "formatDates of " + std::to_string(dates.size()) + " dates");
+
+        std::vector<Date> parsed(dates.size());
+        check(parseDates(buffer.data(), dates.size(), 11, parsed.data()) == 0 && parsed == dates,
+              "parseDates of the output of formatDates");
+
+        // years outside 0-9999 get a sign and more digits, and do not fit the rows of formatDates
+        check(Date(-5, 3, 1).toString() == "-0005-03-01" && Date(-1, 12, 31).addDays(1) == Date(0, 1, 1) &&
+              Date(0, 1, 1).addDays(-1).toString() == "-0001-12-31", "toString of negative years");
+        check(Date(10000, 1, 1).toString() == "10000-01-01" && Date(2000, 2, 29).addMonths(12 * 123456).toString() == "125456-02-29",
+              "toString of years after 9999");
+        check(Date::FromJulianDay(0).toString() == "-4713-11-24", "toString of julian day 0");
+        check(Date(INT_MIN / 2, 1, 1).toString() == "-" + std::to_string(-(long long)(INT_MIN / 2)) + "-01-01",
+              "toString of the year " + std::to_string(INT_MIN / 2));
+
+        Date outOfRange[] = { Date(2000, 1, 1), Date(10000, 1, 1) };
+        bool isThrown     = false;
+
+        try {
+            formatDates(outOfRange, 2, &buffer[0], 11);
+        } catch (const std::out_of_range&) {
+            isThrown = true;
+        }
+
+        check(isThrown && buffer.compare(0, 11, "2000-01-01\n") == 0 && buffer.compare(11, 11, expected[1] + "\n") == 0,
+              "formatDates of the year 10000 throws std::out_of_range");
+
+        std::cout << "decode, format and calendar arithmetic of Date checked" << std::endl << std::endl;
+    }
+
+    /**
+     * @brief The CountingResource class counts bytes taken from and given back to new/delete
+     *        and the most bytes held at once
+     */
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        size_t allocated   = 0;
+        size_t deallocated = 0;
+        size_t peak        = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            allocated += bytes;
+            peak       = std::max(peak, allocated - deallocated);
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+            deallocated += bytes;
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    void checkMemoryResources() {
+        printTitle("MEMORY RESOURCES CHECK");
+
+        std::mt19937     random(50);
+        CountingResource resource;
+
+        // anything that falls back to the default resource throws std::bad_alloc
+        std::pmr::memory_resource* defaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+        try {
+            {
+                BTree<int, int*> tree(3, &resource);
+                std::vector<int> keys(5000);
+
+                for (int& key : keys) {
+                    key = (int)(random() % 1000);
+                    tree.add(key, &key);
+                }
+
+                check(tree.size() == (int)keys.size() && *tree.lookup(keys[0]) == keys[0] &&
+                      tree.lookupRange(0, 999).size() == keys.size(), "BTree on a memory resource");
+            }
+
+            check(resource.allocated > 0 && resource.allocated == resource.deallocated,
+                  "BTree takes all its nodes from the memory resource and gives them back");
+
+            {
+                FibonacciHeap<int, int> heap(INT_MIN, &resource);
+                std::multiset<int>      model;
+
+                for (int i = 0; i < 2000; i++) {
+                    int key = (int)(random() % 100000);
+
+                    heap.insert(heap.createNode(key, i));
+                    model.insert(key);
+                }
+
+                bool isOrdered = true;
+                for (int key : model) {
+                    Node<int, int>* node = heap.extractMin();
+
+                    isOrdered = isOrdered && node->key == key;
+                    heap.destroyNode(node);
+                }
+
+                check(isOrdered, "FibonacciHeap with nodes made by createNode");
+            }
+
+            check(resource.allocated == resource.deallocated, "FibonacciHeap gives back its nodes and buffers");
+
+            {
+                AdjacencyMatrix<int, int>     graph(&resource);
+                std::set<std::pair<int, int>> model;
+
+                for (int vertex = 0; vertex < 100; vertex++)
+                    graph.insertVertex(vertex);
+
+                for (int i = 0; i < 2000; i++) {
+                    int from = (int)(random() % 100);
+                    int to   = (int)(random() % 100);
+
+                    graph.insertEdge(from, to, i);
+                    model.insert({ from, to });
+                }
+
+                for (int vertex = 0; vertex < 100; vertex += 3) {
+                    graph.removeVertex(vertex);
+
+                    for (auto it = model.begin(); it != model.end(); )
+                        it = it->first == vertex || it->second == vertex ? model.erase(it) : std::next(it);
+                }
+
+                graph.compact();
+
+                bool isAligned = true;
+                for (int i = 0; i < graph.indexCount(); i++)
+                    isAligned = isAligned && (uintptr_t)graph.edgeRow(i) % bit_row::ROW_ALIGNMENT == 0;
+
+                check(graph.numberOfEdges() == model.size() && graph.resource() == &resource && isAligned,
+                      "AdjacencyMatrix on a memory resource keeps its rows aligned");
+            }
+
+            check(resource.allocated == resource.deallocated, "AdjacencyMatrix gives back its rows, sets and index");
+
+            size_t before = resource.allocated;
+
+            std::vector<std::pair<int, int>> pairs(5000);
+            std::vector<int>                 ints(5000);
+            std::vector<double>              doubles(5000);
+
+            for (size_t i = 0; i < pairs.size(); i++) {
+                pairs[i]   = { (int)(random() % 100), (int)i };
+                ints[i]    = (int)random();
+                doubles[i] = (double)(int)random() / 7;
+            }
+
+            std::vector<std::pair<int, int>> byFirst       = pairs;
+            std::vector<std::pair<int, int>> sortedPairs   = pairs;
+            std::vector<int>                 sortedInts    = ints;
+            std::vector<double>              sortedDoubles = doubles;
+
+            std::stable_sort(byFirst.begin(), byFirst.end(),
+                             [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+            std::sort(sortedPairs.begin(), sortedPairs.end());
+            std::sort(sortedInts.begin(), sortedInts.end());
+            std::sort(sortedDoubles.begin(), sortedDoubles.end());
+
+            std::vector<std::pair<int, int>> projected = pairs;
+
+            mergeSort(projected.begin(), projected.end(), std::less<>(), &std::pair<int, int>::first, &resource);
+            mergeSort(pairs, &resource);
+            mergeSort(ints, SortEngine::RadixSort, &resource);
+            mergeSort(doubles, &resource);
+
+            check(projected == byFirst && pairs == sortedPairs && ints == sortedInts && doubles == sortedDoubles,
+                  "mergeSort with buffers from a memory resource");
+            check(resource.allocated > before && resource.allocated == resource.deallocated,
+                  "mergeSort takes its buffers from the memory resource");
+
+            // the run buffer, the scratch buffer of its sort and the blocks of the merge together stay in the budget
+            for (size_t budget : { (size_t)1 << 10, (size_t)1 << 13, (size_t)1 << 16, (size_t)1 << 20 }) {
+                std::vector<SortItem> items = randomSortItems(random, 20000, 500);
+
+                std::vector<SortItem> expected = items;
+                std::stable_sort(expected.begin(), expected.end());
+
+                resource.peak = 0;
+
+                std::vector<SortItem> sorted;
+
+                {
+                    ExternalMergeSort<SortItem> sort(budget, ".", 1 << 12, &resource);
+
+                    for (const SortItem& item : items)
+                        sort.push(item);
+
+                    sort.finish([&](const SortItem* data, size_t count) { sorted.insert(sorted.end(), data, data + count); });
+                }
+
+                check(sorted == expected && resource.peak > budget / 4 && resource.peak <= budget,
+                      "ExternalMergeSort with a budget of " + std::to_string(budget) + " bytes uses at most the budget");
+            }
+
+            check(resource.allocated == resource.deallocated, "ExternalMergeSort gives back its buffers and blocks");
+        } catch (const std::bad_alloc&) {
+            check(false, "a structure allocated from the default memory resource");
+        }
+
+        std::pmr::set_default_resource(defaultResource);
+
+        std::cout << "BTree, FibonacciHeap, AdjacencyMatrix, mergeSort and ExternalMergeSort on a counting memory resource checked"
+                  << std::endl << std::endl;
+    }
+
+}
 
 int main() {
 
@@ -24,6 +2263,8 @@ int main() {
                      " does w+1 element exist: " << tree.contains(w+1) << std::endl;
     }
 
+    check(tree.size() == (int)data.size(), "size() of BTree counts every added element");
+
     std::cout << std::endl;
 
     // checking elements removing
@@ -72,7 +2313,33 @@ int main() {
         std::cout << "min element after " << i+1 << " deletion " << minNode->value << std::endl;
     } 
 
-    return 0;
+    std::cout << std::endl;
+
+    checkCsrGraph();
+    checkAdjacencyList();
+    checkBitRows();
+    checkFlatBuffers();
+    checkVertexInterner();
+    checkCompaction();
+    checkBatchInsertion();
+    checkGraphFile();
+    checkEdgeListLoader();
+    checkConcurrentAdjacencyMatrix();
+    checkPrimEngines();
+    checkParallelBoruvka();
+    checkDynamicMinSpanningForest();
+    checkShortestPaths();
+    checkParallelMergeSort();
+    checkAdaptiveMergeSort();
+    checkSimdSort();
+    checkExternalMergeSort();
+    checkRadixSort();
+    checkKeyProjectionSort();
+    checkDateParser();
+    checkDateCalendar();
+    checkMemoryResources();
+
+    return failures == 0 ? 0 : 1;
 }
 
 
@@ -3,11 +3,13 @@
 #include <vector>
 #include <cmath>
 #include <stdexcept>
+#include <memory_resource>
 
 #include "fibonacci_heap/fibonacci_heap_node.h"
 
 /**
- * @brief The FibonacciHeap class implements a minimum priority queue structure
+ * @brief The FibonacciHeap class implements a minimum priority queue structure, nodes made by createNode
+ *        and the buffers of consolidation are allocated from a memory resource
  *
  * @author  Evgeny Gerasimov
  * @version 1.0; 17.04.2022
@@ -24,6 +26,9 @@ private:
 
     K minPossibleKey;
 
+    std::pmr::vector<Node<K, V>*> rootsByDegree; // buffers of consolidate, kept between the calls
+    std::pmr::vector<Node<K, V>*> roots;
+
     /**
      * Worst case time complexity - O(1)
      *
@@ -87,9 +92,11 @@ private:
             parent->child = nullptr;
         else {
             parent->child = child->right;
-            child->parent = nullptr;
             unlinkNode(child);
         }
+
+        child->parent = nullptr;
+        child->mark   = false;
     }
 
     /**
@@ -98,38 +105,42 @@ private:
      * @brief consolidate perform a merge of root trees into trees of different size
      */
     void consolidate() {
-        int Dn = int(1 + log2(size()));
+        std::pmr::vector<Node<K, V>*>& degA = rootsByDegree;
+        degA.assign(int(2 + 1.5 * log2(size() + 1)), nullptr);
 
-        std::vector<Node<K, V>*> degA(Dn, nullptr);
-
-        Node<K, V>* current = minNode;
+        // roots are collected first because linking changes the root list
+        roots.clear();
 
+        Node<K, V>* root = minNode;
         do {
+            roots.push_back(root);
+            root = root->right;
+        } while (root != minNode);
+
+        for (Node<K, V>* current : roots) {
             int degree = current->degree;
 
-            while (degA[degree] != nullptr && degA[degree] != current) {
+            while (degA[degree] != nullptr) {
                 Node<K, V>* y = degA[degree];
 
-                if (current->key > y->key)
+                if (y->key < current->key)
                     std::swap(current, y);
 
-                if (y == minNode)
-                    minNode = current;
-
                 moveChildToParent(y, current);
 
                 degA[degree] = nullptr;
                 degree++;
+
+                if (degree == (int)degA.size())
+                    degA.push_back(nullptr);
             }
 
             degA[degree] = current;
-            current = current->right;
-
-        } while (current != minNode);
+        }
 
         minNode = nullptr;
 
-        for (int i = 0; i < Dn; i++) {
+        for (int i = 0; i < (int)degA.size(); i++) {
             if (degA[i] != nullptr) {
                 Node<K, V>* prevMin = minNode;
 
@@ -152,6 +163,7 @@ private:
         unlinkNode(child);
 
         child->parent = parent;
+        child->mark   = false;
         if (parent->child != nullptr)
             insertNode(parent->child, child);
         else {
@@ -187,13 +199,37 @@ private:
         node->right  = node;
         node->left   = node;
         node->parent = nullptr;
+        node->mark   = false;
 
         // putting it into main forest (where minNode is)
         insertNode(minNode, node);
     }
 
+    /**
+     * Amortized time complexity - O(1)
+     *
+     * @brief cascadingCut marks the node that lost a child, or moves it to the root if it has already lost one,
+     *        and continues with its parent, this keeps degrees of the nodes O(log(n))
+     * @param node - node that lost a child
+     */
+    void cascadingCut(Node<K, V>* node) {
+        while (node->parent != nullptr) {
+            if (!node->mark) {
+                node->mark = true;
+                return;
+            }
+
+            Node<K, V>* parent = node->parent;
+
+            cut(node);
+
+            node = parent;
+        }
+    }
+
 public:
-    FibonacciHeap(K minPossibleKey) : minPossibleKey(minPossibleKey) {
+    FibonacciHeap(K minPossibleKey, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : minPossibleKey(minPossibleKey), rootsByDegree(resource), roots(resource) {
         minNode = nullptr;
         numberOfNodes = 0;
     }
@@ -203,6 +239,36 @@ public:
             extractMin();
     }
 
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief createNode allocates a node from the memory resource of the heap, the node is not inserted
+     * @param key - key of the node
+     * @param value - value of the node
+     * @return new node
+     */
+    Node<K, V>* createNode(const K& key, const V& value) {
+        std::pmr::polymorphic_allocator<Node<K, V>> allocator(roots.get_allocator().resource());
+
+        Node<K, V>* node = allocator.allocate(1);
+        allocator.construct(node, key, value);
+
+        return node;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief destroyNode frees a node made by createNode, the node must not be in the heap
+     * @param node - node to free
+     */
+    void destroyNode(Node<K, V>* node) {
+        std::pmr::polymorphic_allocator<Node<K, V>> allocator(roots.get_allocator().resource());
+
+        node->~Node<K, V>();
+        allocator.deallocate(node, 1);
+    }
+
     /**
      * Amortized time complexity - O(1)
      * @brief insert inserts node into heap
@@ -268,16 +334,17 @@ public:
      * @param newKey - new key to insert in node
      */
     void decreaseKey(Node<K, V> *item, const K &newKey) {
-        if (item->parent != nullptr && newKey > item->parent->key) {
-            item->key = newKey;
-            return;
-        }
-
         item->key = newKey;
 
-        cut(item);
+        Node<K, V>* parent = item->parent;
+
+        if (parent != nullptr && item->key < parent->key) {
+            cut(item);
+            cascadingCut(parent);
+        }
 
-        minNode = item;
+        if (item->key < minNode->key)
+            minNode = item;
     }
 
     /**
@@ -290,14 +357,23 @@ public:
         if (size() == 0)
             return;
 
-        decreaseKey(item, minPossibleKey);
+        item->key = minPossibleKey;
+
+        Node<K, V>* parent = item->parent;
+
+        if (parent != nullptr) {
+            cut(item);
+            cascadingCut(parent);
+        }
+
+        minNode = item; // the node has the minimum possible key now
         extractMin();
     }
 
     /**
-     * Amortized time complexity - O(1)
+     * Worst case time complexity - O(1)
      *
-     * @brief unionWith add another heap into current one
+     * @brief unionWith moves all the nodes of another heap into current one, another heap becomes empty
      * @param anotherQueue - heap to add
      */
     void unionWith(FibonacciHeap<K, V> &anotherQueue) {
@@ -305,16 +381,35 @@ public:
             return;
 
         if (size() == 0) {
-            minNode       = anotherQueue.minNode;
-            numberOfNodes = anotherQueue.size();
-            return;
+            minNode = anotherQueue.minNode;
+        } else {
+            // splicing two circular root lists
+            Node<K, V>* last        = minNode->left;
+            Node<K, V>* anotherLast = anotherQueue.minNode->left;
+
+            last->right                = anotherQueue.minNode;
+            anotherQueue.minNode->left = last;
+            anotherLast->right         = minNode;
+            minNode->left              = anotherLast;
+
+            if (anotherQueue.minNode->key < minNode->key)
+                minNode = anotherQueue.minNode;
         }
 
-        minNode->unionWith(anotherQueue.minNode);
         numberOfNodes += anotherQueue.size();
 
-        if (anotherQueue.minNode < minNode)
-            minNode = anotherQueue.minNode;
+        anotherQueue.clear(); // the nodes belong to this heap now
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief clear forgets all the nodes of the heap without visiting them (notice - the nodes are not freed
+     *        and have to be reinitialized before they are inserted again)
+     */
+    void clear() {
+        minNode       = nullptr;
+        numberOfNodes = 0;
     }
 
     /**
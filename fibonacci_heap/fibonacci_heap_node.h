@@ -12,9 +12,10 @@
 template <typename K, typename V>
 class Node {
 public:
-    K   key;
-    V   value;
-    int degree;
+    K    key;
+    V    value;
+    int  degree;
+    bool mark;  // true if the node has lost a child since it became a child itself
 
     Node<K, V>* parent;
     Node<K, V>* left;
@@ -23,6 +24,7 @@ public:
 
     Node(const K& key, const V& value) : key(key), value(value) {
         degree = 0;
+        mark   = false;
 
         parent = child = left = right = nullptr;
     }
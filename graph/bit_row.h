@@ -0,0 +1,166 @@
+#pragma once
+
+#include <new>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * Functions over rows of 64-bit words used as bitsets by graph implementations.
+ * Loops run word by word without branches so that the compiler can vectorize them
+ * (e.g. with -mavx512vpopcntdq or -mavx2) and fall back to scalar popcount otherwise.
+ */
+namespace bit_row {
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief popcount returns number of set bits in a word
+     * @param word - given word
+     * @return number of set bits in a word
+     */
+    inline int popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(word);
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief wordsFor returns number of words needed to store the given number of bits
+     * @param bits - number of bits
+     * @return number of words needed to store the given number of bits
+     */
+    inline size_t wordsFor(size_t bits) {
+        return (bits + 63) / 64;
+    }
+
+    const size_t ROW_ALIGNMENT = 64; // bytes, a cache line and the width of an AVX-512 register
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief paddedWordsFor returns number of words of a row of the given number of bits padded to ROW_ALIGNMENT,
+     *        so loops over padded rows have no scalar tail and every row of an aligned buffer starts aligned
+     * @param bits - number of bits
+     * @return number of words of a padded row
+     */
+    inline size_t paddedWordsFor(size_t bits) {
+        const size_t alignmentWords = ROW_ALIGNMENT / sizeof(uint64_t);
+
+        return (wordsFor(bits) + alignmentWords - 1) / alignmentWords * alignmentWords;
+    }
+
+    /**
+     * @brief The AlignedAllocator struct allocates buffers aligned to ROW_ALIGNMENT from a memory resource
+     * @param <T> the type of elements
+     */
+    template <typename T>
+    struct AlignedAllocator {
+        typedef T value_type;
+
+        std::pmr::memory_resource* resource;
+
+        AlignedAllocator(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : resource(resource) { }
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U>& other) : resource(other.resource) { }
+
+        T* allocate(size_t n) {
+            return static_cast<T*>(resource->allocate(n * sizeof(T), ROW_ALIGNMENT));
+        }
+
+        void deallocate(T* pointer, size_t n) {
+            resource->deallocate(pointer, n * sizeof(T), ROW_ALIGNMENT);
+        }
+
+        template <typename U>
+        bool operator == (const AlignedAllocator<U>& other) const { return resource->is_equal(*other.resource); }
+
+        template <typename U>
+        bool operator != (const AlignedAllocator<U>& other) const { return !(*this == other); }
+    };
+
+    typedef std::vector<uint64_t, AlignedAllocator<uint64_t>> Words; // words of rows aligned to ROW_ALIGNMENT
+
+    inline bool test(const uint64_t* row, size_t bit) {
+        return (row[bit >> 6] >> (bit & 63)) & 1;
+    }
+
+    inline void set(uint64_t* row, size_t bit) {
+        row[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+
+    inline void reset(uint64_t* row, size_t bit) {
+        row[bit >> 6] &= ~(uint64_t(1) << (bit & 63));
+    }
+
+    /**
+     * Worst case time complexity - O(words)
+     *
+     * @brief count returns number of set bits in a row
+     * @param row - given row
+     * @param words - length of the row in words
+     * @return number of set bits in a row
+     */
+    inline size_t count(const uint64_t* row, size_t words) {
+        size_t result = 0;
+
+        for (size_t i = 0; i < words; i++)
+            result += popcount(row[i]);
+
+        return result;
+    }
+
+    /**
+     * Worst case time complexity - O(words)
+     *
+     * @brief countAnd returns number of bits set in both rows
+     * @param row1 - first row
+     * @param row2 - second row
+     * @param words - length of the rows in words
+     * @return number of bits set in both rows
+     */
+    inline size_t countAnd(const uint64_t* row1, const uint64_t* row2, size_t words) {
+        size_t result = 0;
+
+        for (size_t i = 0; i < words; i++)
+            result += popcount(row1[i] & row2[i]);
+
+        return result;
+    }
+
+    /**
+     * Worst case time complexity - O(words + number of set bits)
+     *
+     * @brief forEach calls function(bit) for every set bit of a row in increasing order
+     * @param row - given row
+     * @param words - length of the row in words
+     * @param function - callback for every set bit
+     */
+    template <typename F>
+    void forEach(const uint64_t* row, size_t words, F function) {
+        for (size_t i = 0; i < words; i++) {
+            uint64_t word = row[i];
+
+            while (word != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+                int bit = __builtin_ctzll(word);
+#else
+                int bit = 0;
+                while (((word >> bit) & 1) == 0)
+                    bit++;
+#endif
+                function(i * 64 + bit);
+                word &= word - 1;
+            }
+        }
+    }
+}
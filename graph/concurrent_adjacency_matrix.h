@@ -0,0 +1,386 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdint>
+
+#include "graph/graph.h"
+#include "graph/bit_row.h"
+#include "graph/vertex_interner.h"
+
+/**
+ * @brief The ConcurrentAdjacencyMatrix class implements adjacency matrix graph that can be changed and read
+ *        from several threads at the same time
+ *
+ * Synchronization:
+ *  - vertexMutex (shared) is held by edge updates and by reads that resolve vertices (indexOf, areAdjacent, degree),
+ *    vertexMutex (exclusive) is held by insertVertex and removeVertex, so the matrix grows while no edge is updated;
+ *  - edge updates of row i are serialized by the stripe lock i % STRIPES, rows in other stripes are updated in parallel;
+ *  - edge existence bits and degree counters are atomics, so areAdjacentById and degreeById take no locks at all,
+ *    readers on hot paths resolve their vertices once with indexOf and then read by indexes.
+ *
+ * Bit rows are padded and aligned to 64 bytes as in AdjacencyMatrix, so writers of different rows do not share
+ * cache lines. Every edge is also kept in the row of its end in a transposed bit matrix, so removeVertex walks
+ * only the set bits of the two rows of the vertex.
+ *
+ * Growth publishes a new table through an atomic pointer. Old tables are kept until the graph is destroyed
+ * so that lock-free readers never touch freed memory, with doubling they take less than a half of the current table.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     Graph
+ * @see     AdjacencyMatrix
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class ConcurrentAdjacencyMatrix : public Graph<V, E> {
+private:
+    static const int STRIPES = 64;
+
+    /**
+     * @brief The Table struct keeps the matrix of one size
+     */
+    struct Table {
+        typedef std::vector<std::atomic<uint64_t>, bit_row::AlignedAllocator<std::atomic<uint64_t>>> AtomicWords;
+
+        int    maximumSize;
+        size_t wordsPerRow;
+
+        AtomicWords                         edgeBits;   // row "from" has bit "to" set for edge from -> to
+        AtomicWords                         inEdgeBits; // row "to" has bit "from" set for edge from -> to
+        std::unique_ptr<E[]>                matrix;
+        std::unique_ptr<std::atomic<int>[]> outDegree;
+        std::unique_ptr<std::atomic<int>[]> inDegree;
+
+        explicit Table(int maximumSize) : maximumSize(maximumSize), wordsPerRow(bit_row::paddedWordsFor(maximumSize)),
+                                          edgeBits(maximumSize * wordsPerRow), inEdgeBits(maximumSize * wordsPerRow) {
+            matrix.reset(new E[(size_t)maximumSize * maximumSize]);
+            outDegree.reset(new std::atomic<int>[maximumSize]);
+            inDegree.reset(new std::atomic<int>[maximumSize]);
+
+            for (size_t i = 0; i < maximumSize * wordsPerRow; i++) {
+                edgeBits[i].store(0, std::memory_order_relaxed);
+                inEdgeBits[i].store(0, std::memory_order_relaxed);
+            }
+
+            for (int i = 0; i < maximumSize; i++) {
+                outDegree[i].store(0, std::memory_order_relaxed);
+                inDegree[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<uint64_t>& word(int from, int to) {
+            return edgeBits[from * wordsPerRow + (to >> 6)];
+        }
+
+        std::atomic<uint64_t>& inWord(int from, int to) {
+            return inEdgeBits[to * wordsPerRow + (from >> 6)];
+        }
+
+        /**
+         * Worst case time complexity - O(wordsPerRow + number of set bits)
+         *
+         * @brief forEachBit calls function(bit) for every set bit of a row of the given bits,
+         *        must be called while the row is not changed
+         */
+        template <typename F>
+        void forEachBit(const AtomicWords& bits, int row, F function) const {
+            for (size_t i = 0; i < wordsPerRow; i++) {
+                uint64_t word = bits[row * wordsPerRow + i].load(std::memory_order_relaxed);
+
+                bit_row::forEach(&word, 1, [&](size_t bit) { function((int)(i * 64 + bit)); });
+            }
+        }
+
+        E& weight(int from, int to) {
+            return matrix[(size_t)from * maximumSize + to];
+        }
+    };
+
+    std::atomic<Table*>                 table;
+    std::vector<std::unique_ptr<Table>> tables; // current and retired tables
+
+    mutable std::shared_mutex vertexMutex;
+    mutable std::mutex        stripes[STRIPES];
+
+    VertexInterner<V> vertices;
+    std::queue<int>   freeIndexes;
+    int               lastIndex;
+
+    std::atomic<int> numberOfVertices;
+
+    /**
+     * Worst case time complexity - O(n^2)
+     *
+     * @brief expandMatrix publishes a matrix twice as big, must be called under exclusive vertexMutex
+     */
+    void expandMatrix() {
+        Table* current = table.load(std::memory_order_relaxed);
+
+        std::unique_ptr<Table> expanded(new Table(current->maximumSize * 2));
+
+        for (int i = 0; i < lastIndex; i++) {
+            for (size_t word = 0; word < current->wordsPerRow; word++) {
+                expanded->edgeBits[i * expanded->wordsPerRow + word].store(
+                        current->edgeBits[i * current->wordsPerRow + word].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                expanded->inEdgeBits[i * expanded->wordsPerRow + word].store(
+                        current->inEdgeBits[i * current->wordsPerRow + word].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+            }
+
+            for (int j = 0; j < lastIndex; j++)
+                expanded->weight(i, j) = current->weight(i, j);
+
+            expanded->outDegree[i].store(current->outDegree[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            expanded->inDegree[i].store(current->inDegree[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        table.store(expanded.get(), std::memory_order_release);
+        tables.push_back(std::move(expanded));
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief setEdge sets existence bit and weight of the edge, must be called under shared vertexMutex
+     */
+    void setEdge(int fromIndex, int toIndex, const E& edge) {
+        Table* current = table.load(std::memory_order_acquire);
+
+        std::lock_guard<std::mutex> lock(stripes[fromIndex % STRIPES]);
+
+        current->weight(fromIndex, toIndex) = edge;
+
+        uint64_t bit = uint64_t(1) << (toIndex & 63);
+
+        if ((current->word(fromIndex, toIndex).fetch_or(bit, std::memory_order_acq_rel) & bit) == 0) {
+            current->inWord(fromIndex, toIndex).fetch_or(uint64_t(1) << (fromIndex & 63), std::memory_order_relaxed);
+            current->outDegree[fromIndex].fetch_add(1, std::memory_order_relaxed);
+            current->inDegree[toIndex].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief clearEdge clears existence bit of the edge, must be called under vertexMutex
+     */
+    void clearEdge(Table* current, int fromIndex, int toIndex) {
+        uint64_t bit = uint64_t(1) << (toIndex & 63);
+
+        if ((current->word(fromIndex, toIndex).fetch_and(~bit, std::memory_order_acq_rel) & bit) != 0) {
+            current->inWord(fromIndex, toIndex).fetch_and(~(uint64_t(1) << (fromIndex & 63)), std::memory_order_relaxed);
+            current->outDegree[fromIndex].fetch_sub(1, std::memory_order_relaxed);
+            current->inDegree[toIndex].fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    ConcurrentAdjacencyMatrix() : lastIndex(0), numberOfVertices(0) {
+        tables.emplace_back(new Table(4));
+        table.store(tables.back().get(), std::memory_order_release);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief indexOf returns index of the vertex, -1 if there is no such vertex in the graph
+     * @param vertex - given vertex
+     * @return index of the vertex, -1 if there is no such vertex in the graph
+     */
+    int indexOf(const V& vertex) const {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+
+        return vertices.indexOf(vertex);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief size returns number of vertices in the graph
+     * @return number of vertices in the graph
+     */
+    int size() const {
+        return numberOfVertices.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Amortised time complexity - O(1), blocks edge updates while the vertex is inserted
+     *
+     * @brief insertVertex inserts vertex into graph
+     * @param vertex - vertex to insert
+     */
+    virtual void insertVertex(const V& vertex) override {
+        std::unique_lock<std::shared_mutex> lock(vertexMutex);
+
+        if (vertices.contains(vertex))
+            return; // such vertex already exists
+
+        int insertIndex;
+
+        if (!freeIndexes.empty()) {
+            insertIndex = freeIndexes.front();
+            freeIndexes.pop();
+        } else {
+            if (lastIndex == table.load(std::memory_order_relaxed)->maximumSize)
+                expandMatrix();
+
+            insertIndex = lastIndex++;
+        }
+
+        numberOfVertices.fetch_add(1, std::memory_order_relaxed);
+
+        vertices.bind(vertex, insertIndex);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief insertEdge inserts edge in a matrix, updates of different rows run in parallel
+     * @param from initial node
+     * @param to end node
+     * @param edge edge that connects 2 nodes
+     */
+    virtual void insertEdge(const V& from, const V& to, const E& edge) override {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+
+        int fromIndex = vertices.indexOf(from);
+        int toIndex   = vertices.indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
+            return; // at least one of the edge does not exist
+
+        setEdge(fromIndex, toIndex, edge);
+    }
+
+    /**
+     * Worst case time complexity - O(lastIndex / 64 + degree), blocks edge updates while the vertex is removed
+     *
+     * @brief removeVertex - removes vertex with all its edges from matrix
+     * @param vertex to remove
+     */
+    virtual void removeVertex(const V& vertex) override {
+        std::unique_lock<std::shared_mutex> lock(vertexMutex);
+
+        int index = vertices.indexOf(vertex);
+
+        if (index == -1)
+            return; // vertex does not exist
+
+        Table* current = table.load(std::memory_order_relaxed);
+
+        current->forEachBit(current->edgeBits, index, [&](int to) { clearEdge(current, index, to); });
+        current->forEachBit(current->inEdgeBits, index, [&](int from) { clearEdge(current, from, index); });
+
+        freeIndexes.push(index);
+        numberOfVertices.fetch_sub(1, std::memory_order_relaxed);
+
+        vertices.unbind(index);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief removeEdge removes directed edge given by 2 vertices
+     * @param from - beginning of the edge
+     * @param to - end of the edge
+     */
+    virtual void removeEdge(const V& from, const V& to) override {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+
+        int fromIndex = vertices.indexOf(from);
+        int toIndex   = vertices.indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
+            return;
+
+        std::lock_guard<std::mutex> stripe(stripes[fromIndex % STRIPES]);
+
+        clearEdge(table.load(std::memory_order_acquire), fromIndex, toIndex);
+    }
+
+    /**
+     * Expected time complexity - O(1), takes shared vertexMutex to resolve the vertices (see areAdjacentById)
+     *
+     * @brief areAdjacent checks whether 2 vertices are adjacent
+     * @param vertex1 - first vertex
+     * @param vertex2 - second vertex
+     * @return true if vertices are adjacent and false in other cases
+     */
+    virtual bool areAdjacent(const V& vertex1, const V& vertex2) override {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+
+        int index1 = vertices.indexOf(vertex1);
+        int index2 = vertices.indexOf(vertex2);
+
+        if (index1 == -1 || index2 == -1)
+            return false;
+
+        return areAdjacentById(index1, index2);
+    }
+
+    /**
+     * Worst case time complexity - O(1), lock-free
+     *
+     * @brief areAdjacentById checks whether vertices with given indexes are adjacent
+     * @param index1 - index of the first vertex
+     * @param index2 - index of the second vertex
+     * @return true if vertices are adjacent and false in other cases
+     */
+    bool areAdjacentById(int index1, int index2) const {
+        Table* current = table.load(std::memory_order_acquire);
+
+        return ((current->word(index1, index2).load(std::memory_order_acquire) >> (index2 & 63)) & 1) ||
+               ((current->word(index2, index1).load(std::memory_order_acquire) >> (index1 & 63)) & 1);
+    }
+
+    /**
+     * Expected time complexity - O(1), takes shared vertexMutex to resolve the vertex (see degreeById)
+     *
+     * @brief degree returns the degree (number of outgoing edges) of a given vertex
+     * @param vertex - given vertex
+     * @return the degree of a given vertex
+     */
+    virtual int degree(const V& vertex) override {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+
+        int index = vertices.indexOf(vertex);
+
+        if (index == -1)
+            return -1; // such vertex does not exist in the graph
+
+        return degreeById(index);
+    }
+
+    /**
+     * Worst case time complexity - O(1), lock-free
+     *
+     * @brief degreeById returns the degree (number of outgoing edges) of a vertex with the given index
+     * @param index - index of the vertex
+     * @return the degree of a vertex
+     */
+    int degreeById(int index) const {
+        return table.load(std::memory_order_acquire)->outDegree[index].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief weightById returns the weight of the edge between vertices with given indexes
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     * @return the weight of the edge
+     */
+    E weightById(int from, int to) const {
+        std::shared_lock<std::shared_mutex> lock(vertexMutex);
+        std::lock_guard<std::mutex> stripe(stripes[from % STRIPES]);
+
+        return table.load(std::memory_order_acquire)->weight(from, to);
+    }
+};
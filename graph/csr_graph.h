@@ -0,0 +1,112 @@
+#pragma once
+
+#include <vector>
+
+#include "graph/flat_hash_map.h"
+
+/**
+ * @brief The CSRGraph class implements an immutable compressed sparse row snapshot of a graph
+ *
+ * Outgoing edges of the vertex with index i are stored in targets[offsets[i] .. offsets[i + 1])
+ * and weights[offsets[i] .. offsets[i + 1]], so traversal touches only contiguous arrays.
+ * Vertex indexes are dense: 0 .. numberOfVertices - 1.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     AdjacencyMatrix
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class CSRGraph {
+public:
+    int numberOfVertices;
+
+    std::vector<size_t> offsets;
+    std::vector<int>    targets;
+    std::vector<E>      weights;
+
+    std::vector<V>      vertexByIndex;
+    FlatHashMap<V, int> indexOfVertex;
+
+    CSRGraph() : numberOfVertices(0), offsets(1, 0) { }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief numberOfEdges returns the number of directed edges in the snapshot
+     * @return the number of directed edges in the snapshot
+     */
+    size_t numberOfEdges() const {
+        return targets.size();
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexCount returns the upper bound of vertex indexes
+     * @return the upper bound of vertex indexes
+     */
+    int indexCount() const {
+        return numberOfVertices;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexExist returns true if there is a vertex with the given index
+     * @param index - index to check
+     * @return true if there is a vertex with the given index
+     */
+    bool indexExist(int index) const {
+        return index >= 0 && index < numberOfVertices;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief indexOf returns index of the vertex, -1 if there is no such vertex
+     * @param vertex - given vertex
+     * @return index of the vertex, -1 if there is no such vertex
+     */
+    int indexOf(const V& vertex) const {
+        const int* index = indexOfVertex.find(vertex);
+
+        return index == nullptr ? -1 : *index;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief vertexAt returns the vertex stored by the given index
+     * @param index - index of the vertex
+     * @return the vertex stored by the given index
+     */
+    const V& vertexAt(int index) const {
+        return vertexByIndex[index];
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief degreeById returns the number of outgoing edges of a vertex with the given index
+     * @param index - index of the vertex
+     * @return the number of outgoing edges of a vertex
+     */
+    int degreeById(int index) const {
+        return (int)(offsets[index + 1] - offsets[index]);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief forEachNeighbor calls function(to, weight) for every outgoing edge of a vertex
+     * @param index - index of the vertex
+     * @param function - callback for every edge
+     */
+    template <typename F>
+    void forEachNeighbor(int index, F function) const {
+        for (size_t i = offsets[index]; i != offsets[index + 1]; i++)
+            function(targets[i], weights[i]);
+    }
+};
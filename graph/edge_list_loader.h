@@ -0,0 +1,257 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+#include "graph/graph.h"
+#include "graph/mapped_file.h"
+#include "graph/flat_hash_map.h"
+
+/**
+ * @brief The EdgeListStats struct describes one run of the edge list loader
+ */
+struct EdgeListStats {
+    size_t bytes          = 0; // size of the input file
+    size_t edges          = 0; // number of parsed edges
+    size_t malformedLines = 0; // number of lines that are not "u v w"
+    double parseSeconds   = 0; // time spent on mapping and parsing the file
+    double buildSeconds   = 0; // time spent on inserting vertices and edges into the graph
+
+    double parseMegabytesPerSecond() const {
+        return parseSeconds == 0 ? 0 : bytes / parseSeconds / 1e6;
+    }
+
+    double totalMegabytesPerSecond() const {
+        return parseSeconds + buildSeconds == 0 ? 0 : bytes / (parseSeconds + buildSeconds) / 1e6;
+    }
+};
+
+/**
+ * Worst case time complexity - O(1)
+ *
+ * @brief skipSpaces moves the position over spaces and tabulations
+ * @param position - current position
+ * @param end - end of the buffer
+ * @return the first position that is not a space or a tabulation
+ */
+inline const char* skipSpaces(const char* position, const char* end) {
+    while (position != end && (*position == ' ' || *position == '\t' || *position == '\r'))
+        position++;
+
+    return position;
+}
+
+/**
+ * Worst case time complexity - O(end - begin)
+ *
+ * @brief countEdgeLines counts the lines whose first character lies in [begin, end) and that parseEdgeChunk
+ *        would try to parse, that is the lines which are neither empty nor start with '#'
+ * @param begin - beginning of the chunk (the beginning of a line)
+ * @param end - end of the chunk
+ * @param bufferEnd - end of the whole buffer, the last line of the chunk may finish after "end"
+ * @return the upper bound of the number of edges in the chunk
+ */
+inline size_t countEdgeLines(const char* begin, const char* end, const char* bufferEnd) {
+    size_t      count    = 0;
+    const char* position = begin;
+
+    while (position < end) {
+        const char* field = skipSpaces(position, bufferEnd);
+
+        if (field != bufferEnd && *field != '\n' && *field != '#')
+            count++;
+
+        const char* lineEnd = static_cast<const char*>(std::memchr(field, '\n', bufferEnd - field));
+        position = lineEnd == nullptr ? bufferEnd : lineEnd + 1;
+    }
+
+    return count;
+}
+
+/**
+ * Worst case time complexity - O(end - begin)
+ *
+ * @brief parseEdgeChunk parses "u v w" lines whose first character lies in [begin, end),
+ *        empty lines and lines starting with '#' are skipped
+ * @param begin - beginning of the chunk (the beginning of a line)
+ * @param end - end of the chunk
+ * @param bufferEnd - end of the whole buffer, the last line of the chunk may finish after "end"
+ * @param edges - resulting edges, room for countEdgeLines(begin, end, bufferEnd) edges
+ * @param malformedLines - number of lines that could not be parsed
+ * @return the number of parsed edges
+ */
+template <typename V, typename E>
+size_t parseEdgeChunk(const char* begin, const char* end, const char* bufferEnd,
+                      std::tuple<V, V, E>* edges, size_t& malformedLines)
+{
+    size_t      count    = 0;
+    const char* position = begin;
+
+    while (position < end) {
+        const char* lineEnd = position;
+        while (lineEnd != bufferEnd && *lineEnd != '\n')
+            lineEnd++;
+
+        const char* field = skipSpaces(position, lineEnd);
+
+        if (field != lineEnd && *field != '#') {
+            V from, to;
+            E weight;
+
+            auto first  = std::from_chars(field, lineEnd, from);
+            field       = skipSpaces(first.ptr, lineEnd);
+            auto second = std::from_chars(field, lineEnd, to);
+            field       = skipSpaces(second.ptr, lineEnd);
+            auto third  = std::from_chars(field, lineEnd, weight);
+
+            if (first.ec == std::errc() && second.ec == std::errc() && third.ec == std::errc() &&
+                skipSpaces(third.ptr, lineEnd) == lineEnd)
+                edges[count++] = std::make_tuple(from, to, weight);
+            else
+                malformedLines++;
+        }
+
+        position = lineEnd + 1;
+    }
+
+    return count;
+}
+
+/**
+ * Worst case time complexity - O(file size / threads) with "threads" cores
+ *
+ * @brief parseEdgeList maps the text file with "u v w" lines and parses it on several threads,
+ *        the file is split into chunks at line boundaries and numbers are parsed with std::from_chars (no locale),
+ *        every chunk counts its lines first, so that all the chunks parse straight into one vector
+ *        allocated once (gaps left by malformed lines are closed in place afterwards)
+ * @param path - path to the file
+ * @param threads - number of threads, 0 means std::thread::hardware_concurrency()
+ * @param stats - statistics of the run, may be nullptr
+ * @return edges in the order of the file
+ */
+template <typename V, typename E>
+std::vector<std::tuple<V, V, E>> parseEdgeList(const std::string& path, unsigned threads = 0,
+                                               EdgeListStats* stats = nullptr)
+{
+    static_assert(std::is_integral<V>::value, "edge list vertices must be integers");
+    static_assert(std::is_arithmetic<E>::value, "edge list weights must be numbers");
+
+    auto start = std::chrono::steady_clock::now();
+
+    MappedFile file(path);
+    file.adviseSequential();
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const char* data = file.data();
+    const char* end  = data + file.size();
+
+    // splitting the file into chunks, every chunk starts at the beginning of a line
+    std::vector<const char*> bounds(threads + 1, end);
+    bounds[0] = data;
+
+    for (unsigned i = 1; i < threads; i++) {
+        const char* bound = std::max(bounds[i - 1], data + file.size() / threads * i);
+
+        while (bound != end && bound != data && *(bound - 1) != '\n')
+            bound++;
+
+        bounds[i] = bound;
+    }
+
+    auto runOnChunks = [&](auto work) {
+        std::vector<std::thread> workers;
+
+        for (unsigned i = 1; i < threads; i++)
+            workers.emplace_back(work, i);
+
+        work(0u);
+
+        for (std::thread& worker : workers)
+            worker.join();
+    };
+
+    // offsets[i] is the position of the first edge of chunk i in the resulting vector
+    std::vector<size_t> offsets(threads + 1, 0);
+
+    runOnChunks([&](unsigned i) { offsets[i + 1] = countEdgeLines(bounds[i], bounds[i + 1], end); });
+
+    for (unsigned i = 0; i < threads; i++)
+        offsets[i + 1] += offsets[i];
+
+    std::vector<std::tuple<V, V, E>> edges(offsets[threads]);
+    std::vector<size_t> parsed(threads, 0);
+    std::vector<size_t> malformed(threads, 0);
+
+    runOnChunks([&](unsigned i) {
+        parsed[i] = parseEdgeChunk<V, E>(bounds[i], bounds[i + 1], end, edges.data() + offsets[i], malformed[i]);
+    });
+
+    size_t total = 0;
+
+    for (unsigned i = 0; i < threads; i++) {
+        if (total != offsets[i])
+            std::move(edges.begin() + offsets[i], edges.begin() + offsets[i] + parsed[i], edges.begin() + total);
+
+        total += parsed[i];
+    }
+
+    edges.resize(total);
+
+    if (stats != nullptr) {
+        stats->bytes          = file.size();
+        stats->edges          = edges.size();
+        stats->malformedLines = 0;
+
+        for (const size_t& count : malformed)
+            stats->malformedLines += count;
+
+        stats->parseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    return edges;
+}
+
+/**
+ * Worst case time complexity - O(parsing + graph.insertVertices + graph.insertEdges)
+ *
+ * @brief loadEdgeList parses the text file with "u v w" lines on several threads and builds the graph
+ *        with one insertVertices and one insertEdges call, vertices are inserted in order of first appearance
+ * @param path - path to the file
+ * @param graph - graph to fill
+ * @param threads - number of parsing threads, 0 means std::thread::hardware_concurrency()
+ * @return statistics of the run
+ */
+template <typename V, typename E>
+EdgeListStats loadEdgeList(const std::string& path, Graph<V, E>& graph, unsigned threads = 0) {
+    EdgeListStats stats;
+
+    std::vector<std::tuple<V, V, E>> edges = parseEdgeList<V, E>(path, threads, &stats);
+
+    auto start = std::chrono::steady_clock::now();
+
+    FlatHashMap<V, char> seen;
+    std::vector<V> vertices;
+
+    for (const auto& edge : edges) {
+        if (seen.insert(std::get<0>(edge), 1))
+            vertices.push_back(std::get<0>(edge));
+        if (seen.insert(std::get<1>(edge), 1))
+            vertices.push_back(std::get<1>(edge));
+    }
+
+    graph.insertVertices(vertices);
+    graph.insertEdges(edges);
+
+    stats.buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return stats;
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <memory_resource>
+
+/**
+ * @brief The FlatHashMap class implements a hash map with open addressing and linear probing,
+ *        all the entries are kept in one contiguous array
+ *
+ * Erasing uses backward shift deletion, so there are no tombstones and probe sequences stay short.
+ * The array is allocated from a memory resource.
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @param   <K> the type of keys
+ * @param   <T> the type of values
+ * @param   <H> the hash function
+ */
+template <typename K, typename T, typename H = std::hash<K>>
+class FlatHashMap {
+private:
+    std::pmr::vector<std::pair<K, T>> slots;
+    std::pmr::vector<uint8_t>         used;
+
+    size_t numberOfElements;
+    size_t mask;
+    int    shift;
+
+    H hasher;
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief home returns the slot where probing for the key starts (fibonacci hashing of the key hash)
+     * @param key - given key
+     * @return the slot where probing for the key starts
+     */
+    size_t home(const K& key) const {
+        return (size_t)(((uint64_t)hasher(key) * 0x9E3779B97F4A7C15ULL) >> shift) & mask;
+    }
+
+    /**
+     * Worst case time complexity - O(n)
+     *
+     * @brief rehash moves all the entries into a table with the given number of slots
+     * @param newCapacity - new number of slots (power of two)
+     */
+    void rehash(size_t newCapacity) {
+        std::pmr::vector<std::pair<K, T>> oldSlots(newCapacity, slots.get_allocator());
+        std::pmr::vector<uint8_t>         oldUsed(newCapacity, 0, used.get_allocator());
+
+        oldSlots.swap(slots);
+        oldUsed.swap(used);
+
+        mask  = newCapacity - 1;
+        shift = 64;
+        for (size_t capacity = newCapacity; capacity > 1; capacity >>= 1)
+            shift--;
+
+        for (size_t i = 0; i < oldSlots.size(); i++) {
+            if (!oldUsed[i])
+                continue;
+
+            size_t position = home(oldSlots[i].first);
+            while (used[position])
+                position = (position + 1) & mask;
+
+            slots[position] = std::move(oldSlots[i]);
+            used[position]  = 1;
+        }
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief findSlot returns the slot of the key, -1 if there is no such key
+     * @param key - key to find
+     * @return the slot of the key, -1 if there is no such key
+     */
+    long long findSlot(const K& key) const {
+        size_t position = home(key);
+
+        while (used[position]) {
+            if (slots[position].first == key)
+                return (long long)position;
+
+            position = (position + 1) & mask;
+        }
+
+        return -1;
+    }
+
+public:
+    explicit FlatHashMap(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : slots(resource), used(resource), numberOfElements(0), mask(0), shift(64) {
+        rehash(16);
+    }
+
+    /**
+     * Worst case time complexity - O(n)
+     *
+     * @brief reserve makes room for the given number of elements without rehashing
+     * @param elements - number of elements
+     */
+    void reserve(size_t elements) {
+        size_t capacity = slots.size();
+
+        while (elements * 8 > capacity * 7)
+            capacity *= 2;
+
+        if (capacity != slots.size())
+            rehash(capacity);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief find returns pointer to the value of the key, nullptr if there is no such key
+     * @param key - key to find
+     * @return pointer to the value of the key, nullptr if there is no such key
+     */
+    T* find(const K& key) {
+        long long slot = findSlot(key);
+
+        return slot == -1 ? nullptr : &slots[slot].second;
+    }
+
+    const T* find(const K& key) const {
+        long long slot = findSlot(key);
+
+        return slot == -1 ? nullptr : &slots[slot].second;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief count returns 1 if there is such key, 0 otherwise
+     * @param key - key to find
+     * @return 1 if there is such key, 0 otherwise
+     */
+    size_t count(const K& key) const {
+        return findSlot(key) == -1 ? 0 : 1;
+    }
+
+    /**
+     * Amortized expected time complexity - O(1)
+     *
+     * @brief insert puts the key with the value into the map, if the key exists its value is replaced
+     * @param key - key to insert
+     * @param value - value of the key
+     * @return true if the key was not in the map before
+     */
+    bool insert(const K& key, const T& value) {
+        long long slot = findSlot(key);
+
+        if (slot != -1) {
+            slots[slot].second = value;
+            return false;
+        }
+
+        if ((numberOfElements + 1) * 8 > slots.size() * 7)
+            rehash(slots.size() * 2);
+
+        size_t position = home(key);
+        while (used[position])
+            position = (position + 1) & mask;
+
+        slots[position] = { key, value };
+        used[position]  = 1;
+
+        numberOfElements++;
+
+        return true;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief erase removes the key from the map
+     * @param key - key to remove
+     * @return true if the key was in the map
+     */
+    bool erase(const K& key) {
+        long long slot = findSlot(key);
+
+        if (slot == -1)
+            return false;
+
+        size_t hole = (size_t)slot;
+        size_t position = (hole + 1) & mask;
+
+        // shifting back the entries whose probe sequence passes through the hole
+        while (used[position]) {
+            size_t start = home(slots[position].first);
+
+            if (((position - start) & mask) >= ((position - hole) & mask)) {
+                slots[hole] = std::move(slots[position]);
+                hole = position;
+            }
+
+            position = (position + 1) & mask;
+        }
+
+        slots[hole] = std::pair<K, T>();
+        used[hole]  = 0;
+
+        numberOfElements--;
+
+        return true;
+    }
+
+    /**
+     * Worst case time complexity - O(capacity)
+     *
+     * @brief clear removes all the elements keeping the capacity
+     */
+    void clear() {
+        for (size_t i = 0; i < slots.size(); i++) {
+            if (used[i]) {
+                slots[i] = std::pair<K, T>();
+                used[i]  = 0;
+            }
+        }
+
+        numberOfElements = 0;
+    }
+
+    size_t size()  const { return numberOfElements; }
+    bool   empty() const { return numberOfElements == 0; }
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+#include <tuple>
+
 /**
  * @brief The Graph class implements interface for graph
  */
@@ -12,4 +15,25 @@ public:
     virtual void removeEdge(const V&, const V&)           = 0; // removes edge from graph
     virtual bool areAdjacent(const V&, const V&)          = 0; // checks whether 2 vertices are adjacent or not
     virtual int  degree(const V&)                         = 0; // returns the degree of a given vertex
+
+    /**
+     * @brief insertVertices inserts all the given vertices in graph, implementations may size storage once
+     * @param vertices - vertices to insert
+     */
+    virtual void insertVertices(const std::vector<V>& vertices) {
+        for (const V& vertex : vertices)
+            insertVertex(vertex);
+    }
+
+    /**
+     * @brief insertEdges inserts all the given (from, to, edge) triples in graph in the given order,
+     *        implementations may size storage once
+     * @param edges - edges to insert
+     */
+    virtual void insertEdges(const std::vector<std::tuple<V, V, E>>& edges) {
+        for (const auto& edge : edges)
+            insertEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+    }
+
+    virtual ~Graph() = default;
 };
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "graph/csr_graph.h"
+#include "graph/mapped_file.h"
+
+/**
+ * Binary graph file, version 1. All the numbers are stored in the native byte order.
+ *
+ * | GraphFileHeader | vertex table V[vertices] | offsets uint64[vertices + 1] | targets int32[edges] | weights E[edges] |
+ *
+ * Every section starts at a multiple of GRAPH_FILE_ALIGNMENT bytes so that it can be used in place after mmap.
+ */
+const char     GRAPH_FILE_MAGIC[8]  = { 'S', 'D', 'S', 'G', 'R', 'A', 'P', 'H' };
+const uint32_t GRAPH_FILE_VERSION   = 1;
+const uint64_t GRAPH_FILE_ALIGNMENT = 64;
+
+/**
+ * @brief The GraphFileHeader struct describes the layout of a binary graph file
+ */
+struct GraphFileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t vertexSize;
+    uint32_t edgeSize;
+    uint32_t reserved;
+
+    uint64_t numberOfVertices;
+    uint64_t numberOfEdges;
+
+    uint64_t vertexTableOffset;
+    uint64_t offsetsOffset;
+    uint64_t targetsOffset;
+    uint64_t weightsOffset;
+    uint64_t fileSize;
+};
+
+/**
+ * Worst case time complexity - O(1)
+ *
+ * @brief alignUp rounds the position up to GRAPH_FILE_ALIGNMENT
+ * @param position - given position
+ * @return the closest aligned position not less than the given one
+ */
+inline uint64_t alignUp(uint64_t position) {
+    return (position + GRAPH_FILE_ALIGNMENT - 1) / GRAPH_FILE_ALIGNMENT * GRAPH_FILE_ALIGNMENT;
+}
+
+/**
+ * Worst case time complexity - O(1)
+ *
+ * @brief layoutGraphFile fills the section offsets and the file size of the header
+ *        from its numbers of vertices and edges and the sizes of vertices and edges
+ * @param header - header with numberOfVertices, numberOfEdges, vertexSize and edgeSize set
+ */
+inline void layoutGraphFile(GraphFileHeader& header) {
+    header.vertexTableOffset = alignUp(sizeof(GraphFileHeader));
+    header.offsetsOffset     = alignUp(header.vertexTableOffset + header.numberOfVertices * header.vertexSize);
+    header.targetsOffset     = alignUp(header.offsetsOffset + (header.numberOfVertices + 1) * sizeof(uint64_t));
+    header.weightsOffset     = alignUp(header.targetsOffset + header.numberOfEdges * sizeof(int32_t));
+    header.fileSize          = header.weightsOffset + header.numberOfEdges * header.edgeSize;
+}
+
+/**
+ * Worst case time complexity - O(V + E)
+ *
+ * @brief writeGraphFile writes the compressed sparse row snapshot into a binary graph file
+ * @param graph - snapshot to write
+ * @param path - path to the resulting file
+ */
+template <typename V, typename E>
+void writeGraphFile(const CSRGraph<V, E>& graph, const std::string& path) {
+    static_assert(std::is_trivially_copyable<V>::value, "vertices must be trivially copyable to be stored in a graph file");
+    static_assert(std::is_trivially_copyable<E>::value, "edges must be trivially copyable to be stored in a graph file");
+    static_assert(sizeof(int) == sizeof(int32_t), "targets are stored as 32-bit integers");
+
+    GraphFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+
+    header.version          = GRAPH_FILE_VERSION;
+    header.vertexSize       = sizeof(V);
+    header.edgeSize         = sizeof(E);
+    header.numberOfVertices = graph.numberOfVertices;
+    header.numberOfEdges    = graph.numberOfEdges();
+
+    layoutGraphFile(header);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error("Cannot create file " + path);
+
+    uint64_t position = 0;
+
+    auto writeAt = [&](uint64_t offset, const void* data, uint64_t size) {
+        static const char padding[GRAPH_FILE_ALIGNMENT] = { };
+
+        file.write(padding, offset - position);
+        file.write(static_cast<const char*>(data), size);
+
+        position = offset + size;
+    };
+
+    std::vector<uint64_t> offsets(graph.offsets.begin(), graph.offsets.end());
+
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.vertexTableOffset, graph.vertexByIndex.data(), header.numberOfVertices * sizeof(V));
+    writeAt(header.offsetsOffset, offsets.data(), offsets.size() * sizeof(uint64_t));
+    writeAt(header.targetsOffset, graph.targets.data(), header.numberOfEdges * sizeof(int32_t));
+    writeAt(header.weightsOffset, graph.weights.data(), header.numberOfEdges * sizeof(E));
+
+    if (!file)
+        throw std::runtime_error("Cannot write file " + path);
+}
+
+/**
+ * @brief The MappedGraph class implements a read-only graph view over a memory-mapped binary graph file,
+ *        nothing is parsed or copied on load, pages are read by the kernel on first access
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     CSRGraph
+ * @see     writeGraphFile
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class MappedGraph {
+    static_assert(std::is_trivially_copyable<V>::value, "vertices must be trivially copyable to be stored in a graph file");
+    static_assert(std::is_trivially_copyable<E>::value, "edges must be trivially copyable to be stored in a graph file");
+
+private:
+    MappedFile file;
+
+    const V*        vertexByIndex;
+    const uint64_t* offsets;
+    const int32_t*  targets;
+    const E*        weights;
+
+public:
+    int    numberOfVertices;
+    size_t edges;
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief MappedGraph maps the binary graph file and checks its header against the layout written by
+     *        writeGraphFile and the first and the last edge offsets, edges are not read
+     *        (notice - a file corrupted inside its sections is caught only by verify)
+     * @param path - path to the file written by writeGraphFile
+     */
+    explicit MappedGraph(const std::string& path) : file(path) {
+        GraphFileHeader header;
+
+        if (file.size() < sizeof(header))
+            throw std::runtime_error("Graph file is too small: " + path);
+
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (std::memcmp(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic)) != 0)
+            throw std::runtime_error("Not a graph file: " + path);
+        if (header.version != GRAPH_FILE_VERSION)
+            throw std::runtime_error("Unsupported graph file version: " + path);
+        if (header.vertexSize != sizeof(V) || header.edgeSize != sizeof(E))
+            throw std::runtime_error("Graph file was written for other vertex or edge types: " + path);
+        if (header.fileSize != file.size())
+            throw std::runtime_error("Graph file is truncated: " + path);
+
+        // every edge takes at least its target in the file, so the layout below cannot overflow
+        if (header.numberOfVertices > (uint64_t)INT_MAX || header.numberOfEdges > file.size())
+            throw std::runtime_error("Graph file has invalid numbers of vertices or edges: " + path);
+
+        GraphFileHeader expected = header;
+        layoutGraphFile(expected);
+
+        if (header.vertexTableOffset != expected.vertexTableOffset || header.offsetsOffset != expected.offsetsOffset ||
+            header.targetsOffset != expected.targetsOffset || header.weightsOffset != expected.weightsOffset ||
+            header.fileSize != expected.fileSize)
+            throw std::runtime_error("Graph file has invalid section offsets: " + path);
+
+        vertexByIndex = reinterpret_cast<const V*>(file.data() + header.vertexTableOffset);
+        offsets       = reinterpret_cast<const uint64_t*>(file.data() + header.offsetsOffset);
+        targets       = reinterpret_cast<const int32_t*>(file.data() + header.targetsOffset);
+        weights       = reinterpret_cast<const E*>(file.data() + header.weightsOffset);
+
+        numberOfVertices = (int)header.numberOfVertices;
+        edges            = header.numberOfEdges;
+
+        if (offsets[0] != 0 || offsets[numberOfVertices] != edges)
+            throw std::runtime_error("Graph file has invalid edge offsets: " + path);
+    }
+
+    /**
+     * Worst case time complexity - O(V + E)
+     *
+     * @brief verify checks that edge offsets are monotone and that every target is a vertex, so that a corrupted
+     *        file cannot make later reads go out of the mapping, it reads the whole file
+     */
+    void verify() const {
+        for (int i = 0; i < numberOfVertices; i++)
+            if (offsets[i] > offsets[i + 1])
+                throw std::runtime_error("Graph file has invalid edge offsets");
+
+        for (size_t i = 0; i < edges; i++)
+            if (targets[i] < 0 || targets[i] >= numberOfVertices)
+                throw std::runtime_error("Graph file has invalid edge targets");
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief numberOfEdges returns the number of directed edges in the graph
+     * @return the number of directed edges in the graph
+     */
+    size_t numberOfEdges() const {
+        return edges;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexCount returns the upper bound of vertex indexes
+     * @return the upper bound of vertex indexes
+     */
+    int indexCount() const {
+        return numberOfVertices;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexExist returns true if there is a vertex with the given index
+     * @param index - index to check
+     * @return true if there is a vertex with the given index
+     */
+    bool indexExist(int index) const {
+        return index >= 0 && index < numberOfVertices;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief vertexAt returns the vertex stored by the given index
+     * @param index - index of the vertex
+     * @return the vertex stored by the given index
+     */
+    const V& vertexAt(int index) const {
+        return vertexByIndex[index];
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief degreeById returns the number of outgoing edges of a vertex with the given index
+     * @param index - index of the vertex
+     * @return the number of outgoing edges of a vertex
+     */
+    int degreeById(int index) const {
+        return (int)(offsets[index + 1] - offsets[index]);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief forEachNeighbor calls function(to, weight) for every outgoing edge of a vertex
+     * @param index - index of the vertex
+     * @param function - callback for every edge
+     */
+    template <typename F>
+    void forEachNeighbor(int index, F function) const {
+        for (uint64_t i = offsets[index]; i != offsets[index + 1]; i++)
+            function((int)targets[i], weights[i]);
+    }
+};
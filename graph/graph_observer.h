@@ -0,0 +1,21 @@
+#pragma once
+
+/**
+ * @brief The GraphObserver class implements interface for objects notified about changes of a graph,
+ *        edges are reported by their vertices, so the notifications stay valid when the graph renumbers indexes
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     AdjacencyMatrix
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class GraphObserver {
+public:
+    virtual void edgeInserted(const V&, const V&, const E&) = 0; // edge is inserted or its weight is replaced
+    virtual void edgeRemoved(const V&, const V&)           = 0; // existing edge is removed
+    virtual void vertexRemoved(const V&) { }                       // vertex is removed after all its edges
+
+    virtual ~GraphObserver() = default;
+};
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <queue>
+
+#include "graph/graph.h"
+#include "graph/csr_graph.h"
+#include "graph/small_vector.h"
+#include "graph/vertex_interner.h"
+
+/**
+ * @brief The AdjacencyList class implements graph using per-vertex contiguous edge lists,
+ *        it needs O(V + E) memory and is interchangeable with AdjacencyMatrix
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     Graph
+ * @see     AdjacencyMatrix
+ * @param   <V> the type of vertices
+ * @param   <E> the type of edges
+ */
+template <typename V, typename E>
+class AdjacencyList : public Graph<V, E> {
+public:
+    /**
+     * @brief The OutEdge struct represents an outgoing edge stored in the list of its beginning
+     */
+    struct OutEdge {
+        int to;
+        E   weight;
+    };
+
+    static const size_t INLINE_EDGES = 4; // edges stored in a vertex without heap allocation
+
+private:
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief findOutEdge returns position of the edge from -> to in the list of "from", -1 if there is no such edge
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     * @return position of the edge in the list of "from", -1 if there is no such edge
+     */
+    int findOutEdge(int from, int to) const {
+        const auto& edges = outEdges[from];
+
+        for (size_t i = 0; i < edges.size(); i++)
+            if (edges[i].to == to)
+                return (int)i;
+
+        return -1;
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief eraseInEdge removes "from" from the list of incoming edges of "to"
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     */
+    void eraseInEdge(int from, int to) {
+        auto& edges = inEdges[to];
+
+        for (size_t i = 0; i < edges.size(); i++) {
+            if (edges[i] == from) {
+                edges.swapRemove(i);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief eraseOutEdge removes edge from -> to from the list of "from"
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     * @return true if such edge existed
+     */
+    bool eraseOutEdge(int from, int to) {
+        int position = findOutEdge(from, to);
+
+        if (position == -1)
+            return false;
+
+        outEdges[from].swapRemove(position);
+
+        return true;
+    }
+
+public:
+    int numberOfVertices;
+    int lastIndex;
+
+    std::vector<SmallVector<OutEdge, INLINE_EDGES>> outEdges;
+    std::vector<SmallVector<int, INLINE_EDGES>>     inEdges;
+
+    VertexInterner<V> vertices; // vertex <-> index mapping
+
+    std::queue<int> freeIndexes;
+
+    AdjacencyList() {
+        numberOfVertices = 0;
+        lastIndex = 0;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief vertexExist returns true if such vertex exists in the graph, false in another case
+     * @param vertex to check
+     * @return true if such vertex exists in the graph, false in another case
+     */
+    bool vertexExist(const V& vertex) const {
+        return vertices.contains(vertex);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief indexOf returns index of the vertex, -1 if there is no such vertex in the graph
+     * @param vertex - given vertex
+     * @return index of the vertex, -1 if there is no such vertex in the graph
+     */
+    int indexOf(const V& vertex) const {
+        return vertices.indexOf(vertex);
+    }
+
+    /**
+     * Amortised time complexity - O(1)
+     *
+     * @brief insertVertex inserts vertex into graph
+     * @param vertex - vertex to insert
+     */
+    virtual void insertVertex(const V& vertex) override {
+        if (vertexExist(vertex))
+            return; // such vertex already exists
+
+        int insertIndex;
+
+        if (!freeIndexes.empty()) {
+            insertIndex = freeIndexes.front();
+            freeIndexes.pop();
+        } else {
+            outEdges.emplace_back();
+            inEdges.emplace_back();
+
+            insertIndex = lastIndex++;
+        }
+
+        numberOfVertices++;
+
+        vertices.bind(vertex, insertIndex);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief insertEdge inserts edge in a graph, if such edge already exists its weight is replaced
+     * @param from initial node
+     * @param to end node
+     * @param edge edge that connects 2 nodes
+     */
+    virtual void insertEdge(const V& from, const V& to, const E& edge) override {
+        int fromIndex = indexOf(from);
+        int toIndex   = indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
+            return; // at least one of the edge does not exist
+
+        insertEdgeById(fromIndex, toIndex, edge);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief insertEdgeById inserts edge between vertices with given indexes without hashing the vertices
+     * @param fromIndex - index of initial node
+     * @param toIndex - index of end node
+     * @param edge - edge that connects 2 nodes
+     */
+    void insertEdgeById(int fromIndex, int toIndex, const E& edge) {
+        int position = findOutEdge(fromIndex, toIndex);
+
+        if (position != -1) {
+            outEdges[fromIndex][position].weight = edge;
+            return;
+        }
+
+        outEdges[fromIndex].push_back(OutEdge { toIndex, edge });
+        inEdges[toIndex].push_back(fromIndex);
+    }
+
+    /**
+     * Amortised time complexity - O(vertices.size)
+     *
+     * @brief insertVertices inserts all the given vertices allocating storage once
+     * @param newVertices - vertices to insert
+     */
+    virtual void insertVertices(const std::vector<V>& newVertices) override {
+        outEdges.reserve(lastIndex + newVertices.size());
+        inEdges.reserve(lastIndex + newVertices.size());
+        vertices.reserve(numberOfVertices + newVertices.size());
+
+        for (const V& vertex : newVertices)
+            insertVertex(vertex);
+    }
+
+    /**
+     * Expected time complexity - O(V + E + edges.size * log(edges.size))
+     *
+     * @brief insertEdges inserts all the given (from, to, edge) triples, vertices are resolved once,
+     *        the edges are grouped by source, sorted and deduplicated once per list and then appended,
+     *        so every edge list is grown at most once
+     * @param edges - edges to insert, later ones replace earlier ones between the same vertices
+     */
+    virtual void insertEdges(const std::vector<std::tuple<V, V, E>>& edges) override {
+        std::vector<int> fromIndexes(edges.size());
+        std::vector<int> toIndexes(edges.size());
+
+        std::vector<size_t> start(lastIndex + 1, 0);
+
+        for (size_t i = 0; i < edges.size(); i++) {
+            fromIndexes[i] = indexOf(std::get<0>(edges[i]));
+            toIndexes[i]   = indexOf(std::get<1>(edges[i]));
+
+            if (fromIndexes[i] == -1 || toIndexes[i] == -1)
+                continue; // at least one of the edge does not exist
+
+            start[fromIndexes[i] + 1]++;
+        }
+
+        for (int i = 0; i < lastIndex; i++)
+            start[i + 1] += start[i];
+
+        // stable counting sort by source, edges of vertex i take order[start[i] .. start[i + 1])
+        std::vector<size_t> order(start[lastIndex]);
+        std::vector<size_t> position(start.begin(), start.end() - 1);
+
+        for (size_t i = 0; i < edges.size(); i++)
+            if (fromIndexes[i] != -1 && toIndexes[i] != -1)
+                order[position[fromIndexes[i]]++] = i;
+
+        std::vector<int>    positionOf(lastIndex, -1); // position of the edge to a vertex in the current list
+        std::vector<size_t> appendedEnd(lastIndex, 0);
+        std::vector<size_t> incoming(lastIndex, 0);
+
+        for (int from = 0; from < lastIndex; from++) {
+            auto first = order.begin() + start[from];
+            auto last  = order.begin() + start[from + 1];
+
+            std::stable_sort(first, last, [&](size_t a, size_t b) { return toIndexes[a] < toIndexes[b]; });
+
+            auto& list = outEdges[from];
+
+            for (size_t i = 0; i < list.size(); i++)
+                positionOf[list[i].to] = (int)i;
+
+            // edges that are not in the list yet are moved to the front of the group
+            auto appended = first;
+
+            for (auto it = first; it != last; ++it) {
+                int to = toIndexes[*it];
+
+                if (it + 1 != last && toIndexes[*(it + 1)] == to)
+                    continue; // a later edge between the same vertices replaces this one
+
+                if (positionOf[to] != -1) {
+                    list[positionOf[to]].weight = std::get<2>(edges[*it]);
+                } else {
+                    *appended++ = *it;
+                    incoming[to]++;
+                }
+            }
+
+            appendedEnd[from] = appended - order.begin();
+
+            for (const OutEdge& edge : list)
+                positionOf[edge.to] = -1;
+        }
+
+        for (int i = 0; i < lastIndex; i++)
+            inEdges[i].reserve(inEdges[i].size() + incoming[i]);
+
+        for (int from = 0; from < lastIndex; from++) {
+            outEdges[from].reserve(outEdges[from].size() + (appendedEnd[from] - start[from]));
+
+            for (size_t i = start[from]; i < appendedEnd[from]; i++) {
+                outEdges[from].push_back(OutEdge { toIndexes[order[i]], std::get<2>(edges[order[i]]) });
+                inEdges[toIndexes[order[i]]].push_back(from);
+            }
+        }
+    }
+
+    /**
+     * Worst case time complexity - O(sum of degrees of the vertex and its neighbors)
+     *
+     * @brief removeVertex - removes vertex with all its incoming and outgoing edges from graph
+     * @param vertex to remove
+     */
+    virtual void removeVertex(const V& vertex) override {
+        int index = indexOf(vertex);
+
+        if (index == -1)
+            return; // vertex does not exist
+
+        for (const OutEdge& edge : outEdges[index])
+            if (edge.to != index)
+                eraseInEdge(index, edge.to);
+
+        for (const int& from : inEdges[index])
+            if (from != index)
+                eraseOutEdge(from, index);
+
+        outEdges[index].clear();
+        inEdges[index].clear();
+
+        freeIndexes.push(index);
+        numberOfVertices--;
+
+        vertices.unbind(index);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief removeEdge removes directed edge given by 2 vertices
+     *
+     * @param from - beginning of the edge
+     * @param to - end of the edge
+     */
+    virtual void removeEdge(const V& from, const V& to) override {
+        int fromIndex = indexOf(from);
+        int toIndex   = indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
+            return;
+
+        if (eraseOutEdge(fromIndex, toIndex))
+            eraseInEdge(fromIndex, toIndex);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief areAdjacent checks whether 2 vertices are adjacent
+     * @param vertex1 - first vertex
+     * @param vertex2 - second vertex
+     * @return true if vertices are adjacent and false in other cases
+     */
+    virtual bool areAdjacent(const V& vertex1, const V& vertex2) override {
+        int index1 = indexOf(vertex1);
+        int index2 = indexOf(vertex2);
+
+        if (index1 == -1 || index2 == -1)
+            return false;
+
+        return findOutEdge(index1, index2) != -1 || findOutEdge(index2, index1) != -1;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief degree returns the degree of a given vertex
+     * @param vertex - given vertex
+     * @return the degree of a given vertex
+     */
+    virtual int degree(const V& vertex) override {
+        int index = indexOf(vertex);
+
+        if (index == -1)
+            return -1; // such vertex does not exist in the graph
+
+        return (int)outEdges[index].size();
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexCount returns the upper bound of vertex indexes
+     * @return the upper bound of vertex indexes
+     */
+    int indexCount() const {
+        return lastIndex;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexExist returns true if there is a vertex with the given index
+     * @param index - index to check
+     * @return true if there is a vertex with the given index
+     */
+    bool indexExist(int index) const {
+        return vertices.indexExist(index);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief vertexAt returns the vertex stored by the given index
+     * @param index - index of the vertex
+     * @return the vertex stored by the given index
+     */
+    const V& vertexAt(int index) const {
+        return vertices.vertexAt(index);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief forEachNeighbor calls function(to, weight) for every outgoing edge of a vertex
+     * @param index - index of the vertex
+     * @param function - callback for every edge
+     */
+    template <typename F>
+    void forEachNeighbor(int index, F function) const {
+        for (const OutEdge& edge : outEdges[index])
+            function(edge.to, edge.weight);
+    }
+
+    /**
+     * Worst case time complexity - O(V + E)
+     *
+     * @brief toCSR builds an immutable compressed sparse row snapshot of the graph,
+     *        live vertices are renumbered into 0 .. numberOfVertices - 1 keeping their order
+     * @return compressed sparse row snapshot of the graph
+     */
+    CSRGraph<V, E> toCSR() const {
+        CSRGraph<V, E> csr;
+
+        std::vector<int> newIndex(lastIndex, -1);
+
+        for (int i = 0; i < lastIndex; i++) {
+            if (!indexExist(i))
+                continue;
+
+            newIndex[i] = csr.numberOfVertices++;
+            csr.vertexByIndex.push_back(vertexAt(i));
+        }
+
+        csr.indexOfVertex.reserve(csr.numberOfVertices);
+        for (int i = 0; i < csr.numberOfVertices; i++)
+            csr.indexOfVertex.insert(csr.vertexByIndex[i], i);
+
+        csr.offsets.assign(csr.numberOfVertices + 1, 0);
+
+        for (int i = 0; i < lastIndex; i++)
+            if (indexExist(i))
+                csr.offsets[newIndex[i] + 1] = outEdges[i].size();
+
+        for (int i = 0; i < csr.numberOfVertices; i++)
+            csr.offsets[i + 1] += csr.offsets[i];
+
+        csr.targets.resize(csr.offsets.back());
+        csr.weights.resize(csr.offsets.back());
+
+        for (int i = 0; i < lastIndex; i++) {
+            if (!indexExist(i))
+                continue;
+
+            size_t position = csr.offsets[newIndex[i]];
+
+            for (const OutEdge& edge : outEdges[i]) {
+                csr.targets[position] = newIndex[edge.to];
+                csr.weights[position] = edge.weight;
+                position++;
+            }
+        }
+
+        return csr;
+    }
+};
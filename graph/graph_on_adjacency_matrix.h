@@ -4,15 +4,22 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <queue>
+#include <algorithm>
+#include <memory_resource>
 
 #include "graph/graph.h"
+#include "graph/graph_observer.h"
 #include "graph/edge.h"
+#include "graph/csr_graph.h"
+#include "graph/bit_row.h"
+#include "graph/vertex_interner.h"
 
 #include "fibonacci_heap/fibonacci_heap.h"
 #include "fibonacci_heap/fibonacci_heap_node.h"
 
 /**
- * @brief The AdjacencyMatrix class implements graph using Adjacency matrix
+ * @brief The AdjacencyMatrix class implements graph using Adjacency matrix, the matrix, the rows of edge bits,
+ *        the neighbor sets and the vertex index are allocated from a memory resource
  *
  * @author  Evgeny Gerasimov
  * @version 1.0; 19.04.2022
@@ -24,23 +31,47 @@ template <typename V, typename E>
 class AdjacencyMatrix : public Graph<V, E> {
 private:
     /**
-     * Worst case time complexity - O(n^2)
+     * Worst case time complexity - O(n^2), where n - new size of the matrix
      *
-     * @brief expandMatrix expands curent matrix by 2
+     * @brief resizeMatrix moves first lastIndex rows into new buffers with the given row stride,
+     *        every row is copied in one bulk operation
+     * @param newMaximumSize - new maximum number of vertices (must not be less than lastIndex)
      */
-    void expandMatrix() {
-        int newMaximumSize = maximumSize * 2;
+    void resizeMatrix(int newMaximumSize) {
+        size_t newWordsPerRow = bit_row::paddedWordsFor(newMaximumSize);
+
+        std::pmr::vector<E> newMatrix((size_t)newMaximumSize * newMaximumSize, resource());
+        bit_row::Words      newEdgeBits((size_t)newMaximumSize * newWordsPerRow, 0, edgeBits.get_allocator());
 
-        matrix.resize(newMaximumSize);
-        edgeExist.resize(newMaximumSize);
+        size_t usedWords = bit_row::wordsFor(lastIndex);
 
-        for (int i = 0; i < newMaximumSize; i++) {
-            matrix[i].resize(newMaximumSize);
-            edgeExist[i].resize(newMaximumSize);
-            //isVertexInGraph.resize(newMaximumSize);
+        for (int i = 0; i < lastIndex; i++) {
+            std::move(matrix.begin() + (size_t)i * maximumSize,
+                      matrix.begin() + (size_t)i * maximumSize + lastIndex,
+                      newMatrix.begin() + (size_t)i * newMaximumSize);
+
+            std::copy(edgeBits.begin() + i * wordsPerRow,
+                      edgeBits.begin() + i * wordsPerRow + usedWords,
+                      newEdgeBits.begin() + i * newWordsPerRow);
         }
 
+        matrix.swap(newMatrix);
+        edgeBits.swap(newEdgeBits);
+
+        outDegree.resize(newMaximumSize, 0);
+        inDegree.resize(newMaximumSize, 0);
+
         maximumSize = newMaximumSize;
+        wordsPerRow = newWordsPerRow;
+    }
+
+    /**
+     * Worst case time complexity - O(n^2)
+     *
+     * @brief expandMatrix expands curent matrix by 2
+     */
+    void expandMatrix() {
+        resizeMatrix(maximumSize * 2);
     }
 
 public:
@@ -48,34 +79,158 @@ public:
     int numberOfVertices;
     int lastIndex;
 
-    std::vector<std::vector<E>>    matrix;
-    std::vector<std::vector<bool>> edgeExist;
+    size_t wordsPerRow;
 
-    std::unordered_map<V, int>  indexOfVertex;
-    std::unordered_map<int, V>  vertexByIndex;
+    std::pmr::vector<E>   matrix;   // maximumSize x maximumSize weights, row i starts at i * maximumSize
+    bit_row::Words        edgeBits; // row i starts at i * wordsPerRow and has bit j set if edge i -> j exists,
+                                    // the buffer is aligned and wordsPerRow is padded, so every row is aligned
 
-    std::vector<std::unordered_set<int>> neighbors;
+    std::pmr::vector<int> outDegree;
+    std::pmr::vector<int> inDegree;
 
-    std::queue<int>   freeIndexes;
+    VertexInterner<V> vertices; // vertex <-> index mapping
 
-    AdjacencyMatrix() {
+    std::pmr::vector<std::pmr::unordered_set<int>> neighbors;   // outgoing neighbors of each vertex
+    std::pmr::vector<std::pmr::unordered_set<int>> inNeighbors; // incoming neighbors of each vertex
+
+    std::queue<int, std::pmr::deque<int>> freeIndexes;
+
+    std::vector<GraphObserver<V, E>*> observers; // notified about every change of edges
+
+    explicit AdjacencyMatrix(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : matrix(resource), edgeBits(bit_row::AlignedAllocator<uint64_t>(resource)), outDegree(resource),
+          inDegree(resource), vertices(resource), neighbors(resource), inNeighbors(resource),
+          freeIndexes(std::pmr::deque<int>(resource)) {
         maximumSize = 4;
         numberOfVertices = 0;
         lastIndex = 0;
 
-        matrix.resize(maximumSize, std::vector<E>(maximumSize));
-        edgeExist.resize(maximumSize, std::vector<bool>(maximumSize, false));
+        wordsPerRow = bit_row::paddedWordsFor(maximumSize);
+
+        matrix.resize((size_t)maximumSize * maximumSize);
+        edgeBits.resize((size_t)maximumSize * wordsPerRow, 0);
+
+        outDegree.resize(maximumSize, 0);
+        inDegree.resize(maximumSize, 0);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief resource returns the memory resource the graph is allocated from
+     * @return the memory resource of the graph
+     */
+    std::pmr::memory_resource* resource() const {
+        return matrix.get_allocator().resource();
+    }
+
+    /**
+     * Worst case time complexity - O(n^2), where n - new size of the matrix
+     *
+     * @brief reserve makes room for the given number of vertices so that insertions do not grow the matrix
+     * @param vertices - number of vertices to make room for
+     */
+    void reserve(int vertices) {
+        if (vertices > maximumSize)
+            resizeMatrix(vertices);
+    }
+
+    /**
+     * Worst case time complexity - O(lastIndex^2)
+     *
+     * @brief shrinkToFit releases the rows and columns beyond the last used index
+     */
+    void shrinkToFit() {
+        int newMaximumSize = std::max(lastIndex, 1);
+
+        if (newMaximumSize < maximumSize)
+            resizeMatrix(newMaximumSize);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief addObserver subscribes the observer to changes of edges (notice - the observer must be removed
+     *        before it is destroyed)
+     * @param observer - observer to notify
+     */
+    void addObserver(GraphObserver<V, E>* observer) {
+        observers.push_back(observer);
+    }
+
+    /**
+     * Worst case time complexity - O(number of observers)
+     *
+     * @brief removeObserver unsubscribes the observer from changes of edges
+     * @param observer - observer to remove
+     */
+    void removeObserver(GraphObserver<V, E>* observer) {
+        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief weight returns the weight stored for the edge between vertices with given indexes
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     * @return the weight stored for the edge
+     */
+    E& weight(int from, int to) {
+        return matrix[(size_t)from * maximumSize + to];
+    }
+
+    const E& weight(int from, int to) const {
+        return matrix[(size_t)from * maximumSize + to];
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief edgeRow returns the bitset row of outgoing edges of a vertex with the given index
+     * @param index - index of the vertex
+     * @return pointer to the first word of the row
+     */
+    uint64_t* edgeRow(int index) {
+        return edgeBits.data() + index * wordsPerRow;
+    }
+
+    const uint64_t* edgeRow(int index) const {
+        return edgeBits.data() + index * wordsPerRow;
     }
 
     /**
-     * Worst case time complexity - O(log(map.size))
+     * Worst case time complexity - O(1)
+     *
+     * @brief hasEdge returns true if there is a directed edge between vertices with given indexes
+     * @param from - index of the beginning of the edge
+     * @param to - index of the end of the edge
+     * @return true if there is a directed edge between vertices with given indexes
+     */
+    bool hasEdge(int from, int to) const {
+        return bit_row::test(edgeRow(from), to);
+    }
+
+    /**
+     * Expected time complexity - O(1)
      *
      * @brief vertexExist returns true if such vertex exists in the graph, false in another case
      * @param vertex to check
      * @return true if such vertex exists in the graph, false in another case
      */
-    bool vertexExist(const V& vertex) {
-        return indexOfVertex.count(vertex) == 1;
+    bool vertexExist(const V& vertex) const {
+        return vertices.contains(vertex);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief indexOf returns index of the vertex, -1 if there is no such vertex in the graph
+     * @param vertex - given vertex
+     * @return index of the vertex, -1 if there is no such vertex in the graph
+     */
+    int indexOf(const V& vertex) const {
+        return vertices.indexOf(vertex);
     }
 
     /**
@@ -97,19 +252,82 @@ public:
             if (lastIndex == maximumSize)
                 expandMatrix();
 
-            neighbors.push_back(std::unordered_set<int>());
+            neighbors.emplace_back();   // the sets get the memory resource of the vector
+            inNeighbors.emplace_back();
 
             insertIndex = lastIndex++;
         }
 
         numberOfVertices++;
 
-        indexOfVertex[vertex] = insertIndex;
-        vertexByIndex[insertIndex] = vertex;
+        vertices.bind(vertex, insertIndex);
     }
 
     /**
-     * Worst case time complexity - O(log(map.size))
+     * Worst case time complexity - O(n^2) for one growth of the matrix, O(vertices.size) to insert
+     *
+     * @brief insertVertices inserts all the given vertices growing the matrix at most once
+     * @param newVertices - vertices to insert
+     */
+    virtual void insertVertices(const std::vector<V>& newVertices) override {
+        long long grownBy = (long long)newVertices.size() - (long long)freeIndexes.size();
+
+        if (grownBy > 0)
+            reserve(lastIndex + (int)grownBy);
+
+        vertices.reserve(numberOfVertices + newVertices.size());
+
+        for (const V& vertex : newVertices)
+            insertVertex(vertex);
+    }
+
+    /**
+     * Expected time complexity - O(edges.size + lastIndex)
+     *
+     * @brief insertEdges inserts all the given (from, to, edge) triples, vertices are resolved once,
+     *        neighbor sets are sized once and rows of the matrix are filled one after another
+     * @param edges - edges to insert, later ones replace earlier ones between the same vertices
+     */
+    virtual void insertEdges(const std::vector<std::tuple<V, V, E>>& edges) override {
+        std::pmr::vector<int> fromIndexes(edges.size(), resource());
+        std::pmr::vector<int> toIndexes(edges.size(), resource());
+
+        std::pmr::vector<size_t> rowStart(lastIndex + 1, 0, resource());
+        std::pmr::vector<int>    incoming(lastIndex, 0, resource());
+
+        for (size_t i = 0; i < edges.size(); i++) {
+            fromIndexes[i] = indexOf(std::get<0>(edges[i]));
+            toIndexes[i]   = indexOf(std::get<1>(edges[i]));
+
+            if (fromIndexes[i] == -1 || toIndexes[i] == -1)
+                continue; // at least one of the edge does not exist
+
+            rowStart[fromIndexes[i] + 1]++;
+            incoming[toIndexes[i]]++;
+        }
+
+        for (int i = 0; i < lastIndex; i++) {
+            if (rowStart[i + 1] != 0)
+                neighbors[i].reserve(neighbors[i].size() + rowStart[i + 1]);
+            if (incoming[i] != 0)
+                inNeighbors[i].reserve(inNeighbors[i].size() + incoming[i]);
+
+            rowStart[i + 1] += rowStart[i];
+        }
+
+        // stable counting sort of edges by the beginning so that rows are filled one by one
+        std::pmr::vector<size_t> order(rowStart[lastIndex], resource());
+
+        for (size_t i = 0; i < edges.size(); i++)
+            if (fromIndexes[i] != -1 && toIndexes[i] != -1)
+                order[rowStart[fromIndexes[i]]++] = i;
+
+        for (const size_t& i : order)
+            insertEdgeById(fromIndexes[i], toIndexes[i], std::get<2>(edges[i]));
+    }
+
+    /**
+     * Expected time complexity - O(1)
      *
      * @brief insertEdge inserts edge in a matrix
      * @param from initial node
@@ -117,37 +335,164 @@ public:
      * @param edge edge that connects 2 nodes
      */
     virtual void insertEdge(const V& from, const V& to, const E& edge) override {
-        if (!vertexExist(from) || !vertexExist(to))
+        int fromIndex = indexOf(from);
+        int toIndex   = indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
             return; // at least one of the edge does not exist
 
-        int fromIndex = indexOfVertex[from];
-        int toIndex   = indexOfVertex[to];
+        insertEdgeById(fromIndex, toIndex, edge);
+    }
 
-        matrix[fromIndex][toIndex]    = edge;
-        edgeExist[fromIndex][toIndex] = true;
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief insertEdgeById inserts edge between vertices with given indexes without hashing the vertices
+     * @param fromIndex - index of initial node
+     * @param toIndex - index of end node
+     * @param edge - edge that connects 2 nodes
+     */
+    void insertEdgeById(int fromIndex, int toIndex, const E& edge) {
+        weight(fromIndex, toIndex) = edge;
+
+        if (!hasEdge(fromIndex, toIndex)) {
+            bit_row::set(edgeRow(fromIndex), toIndex);
+
+            outDegree[fromIndex]++;
+            inDegree[toIndex]++;
+        }
 
         neighbors[fromIndex].insert(toIndex);
+        inNeighbors[toIndex].insert(fromIndex);
+
+        for (GraphObserver<V, E>* observer : observers)
+            observer->edgeInserted(vertexAt(fromIndex), vertexAt(toIndex), edge);
     }
 
     /**
-     * Worst case time complexity - O(lastIndex)
+     * Expected time complexity - O(degree), where degree - number of incoming and outgoing edges
      *
-     * @brief removeVertex - removes vertex from matrix
+     * @brief removeVertex - removes vertex with all its incoming and outgoing edges from matrix
      * @param vertex to remove
      */
     virtual void removeVertex(const V& vertex) override {
-        if (!vertexExist(vertex))
+        int index = indexOf(vertex);
+
+        if (index == -1)
             return; // vertex does not exist
 
-        int index = indexOfVertex[vertex];
+        if (!observers.empty()) {
+            for (const int& to : neighbors[index])
+                for (GraphObserver<V, E>* observer : observers)
+                    observer->edgeRemoved(vertex, vertexAt(to));
 
-        for (int i = 0; i < lastIndex; i++)
-            edgeExist[index][i] = edgeExist[i][index] = false;
+            for (const int& from : inNeighbors[index])
+                if (from != index)
+                    for (GraphObserver<V, E>* observer : observers)
+                        observer->edgeRemoved(vertexAt(from), vertex);
+        }
+
+        for (const int& to : neighbors[index]) {
+            bit_row::reset(edgeRow(index), to);
+
+            inDegree[to]--;
+
+            if (to != index)
+                inNeighbors[to].erase(index);
+        }
+
+        for (const int& from : inNeighbors[index]) {
+            if (from == index)
+                continue; // self loop is already removed
+
+            bit_row::reset(edgeRow(from), index);
+
+            outDegree[from]--;
+            neighbors[from].erase(index);
+        }
+
+        neighbors[index].clear();
+        inNeighbors[index].clear();
+
+        outDegree[index] = 0;
+        inDegree[index]  = 0;
 
         freeIndexes.push(index);
+        numberOfVertices--;
 
-        indexOfVertex.erase(indexOfVertex.find(vertex));
-        vertexByIndex.erase(vertexByIndex.find(index));
+        for (GraphObserver<V, E>* observer : observers)
+            observer->vertexRemoved(vertex);
+
+        vertices.unbind(index);
+    }
+
+    /**
+     * Worst case time complexity - O(V^2) to allocate the new matrix, O(V + E) to move edges
+     *
+     * @brief compact renumbers live vertices into 0 .. numberOfVertices - 1 keeping their order
+     *        and shrinks the matrix to the number of live vertices
+     *        (notice - indexes obtained before the call become invalid)
+     */
+    void compact() {
+        std::pmr::vector<int> newIndex(lastIndex, -1, resource());
+
+        int count = 0;
+        for (int i = 0; i < lastIndex; i++)
+            if (indexExist(i))
+                newIndex[i] = count++;
+
+        int    newMaximumSize = std::max(count, 1);
+        size_t newWordsPerRow = bit_row::paddedWordsFor(newMaximumSize);
+
+        std::pmr::vector<E> newMatrix((size_t)newMaximumSize * newMaximumSize, resource());
+        bit_row::Words      newEdgeBits((size_t)newMaximumSize * newWordsPerRow, 0, edgeBits.get_allocator());
+
+        std::pmr::vector<std::pmr::unordered_set<int>> newNeighbors(count, resource());
+        std::pmr::vector<std::pmr::unordered_set<int>> newInNeighbors(count, resource());
+
+        std::pmr::vector<int> newOutDegree(newMaximumSize, 0, resource());
+        std::pmr::vector<int> newInDegree(newMaximumSize, 0, resource());
+
+        VertexInterner<V> newVertices(resource());
+        newVertices.reserve(count);
+
+        for (int i = 0; i < lastIndex; i++) {
+            int from = newIndex[i];
+
+            if (from == -1)
+                continue;
+
+            newVertices.bind(vertexAt(i), from);
+
+            newOutDegree[from] = outDegree[i];
+            newInDegree[from]  = inDegree[i];
+
+            newNeighbors[from].reserve(neighbors[i].size());
+
+            for (const int& vertex : neighbors[i]) {
+                int to = newIndex[vertex];
+
+                newMatrix[(size_t)from * newMaximumSize + to] = std::move(weight(i, vertex));
+                bit_row::set(newEdgeBits.data() + from * newWordsPerRow, to);
+
+                newNeighbors[from].insert(to);
+                newInNeighbors[to].insert(from);
+            }
+        }
+
+        matrix.swap(newMatrix);
+        edgeBits.swap(newEdgeBits);
+        neighbors.swap(newNeighbors);
+        inNeighbors.swap(newInNeighbors);
+        outDegree.swap(newOutDegree);
+        inDegree.swap(newInDegree);
+        std::swap(vertices, newVertices);
+
+        maximumSize = newMaximumSize;
+        wordsPerRow = newWordsPerRow;
+        lastIndex   = count;
+
+        freeIndexes = std::queue<int, std::pmr::deque<int>>(std::pmr::deque<int>(resource()));
     }
 
     /**
@@ -160,16 +505,40 @@ public:
      * @param to - end of the edge
      */
     virtual void removeEdge(const V& from, const V& to) override {
-        if (!vertexExist(from) || !vertexExist(to))
+        int fromIndex = indexOf(from);
+        int toIndex   = indexOf(to);
+
+        if (fromIndex == -1 || toIndex == -1)
             return;
 
-        edgeExist[indexOfVertex[from]][indexOfVertex[to]] = false;
+        removeEdgeById(fromIndex, toIndex);
+    }
 
-        neighbors[indexOfVertex[from]].erase(indexOfVertex[to]);
+    /**
+     * Worst case time complexity - O(V)
+     * Expected - O(1)
+     *
+     * @brief removeEdgeById removes directed edge between vertices with given indexes
+     * @param fromIndex - index of the beginning of the edge
+     * @param toIndex - index of the end of the edge
+     */
+    void removeEdgeById(int fromIndex, int toIndex) {
+        if (hasEdge(fromIndex, toIndex)) {
+            bit_row::reset(edgeRow(fromIndex), toIndex);
+
+            outDegree[fromIndex]--;
+            inDegree[toIndex]--;
+
+            for (GraphObserver<V, E>* observer : observers)
+                observer->edgeRemoved(vertexAt(fromIndex), vertexAt(toIndex));
+        }
+
+        neighbors[fromIndex].erase(toIndex);
+        inNeighbors[toIndex].erase(fromIndex);
     }
 
     /**
-     * Worst case time complexity - O(log(map.size))
+     * Expected time complexity - O(1)
      *
      * @brief areAdjacent checks whether 2 vertices are adjacent
      * @param vertex1 - first vertex
@@ -177,46 +546,213 @@ public:
      * @return true if vertices are adjacent and false in other cases
      */
     virtual bool areAdjacent(const V& vertex1, const V& vertex2) override {
-        if (!vertexExist(vertex1) || !vertexExist(vertex2))
+        int index1 = indexOf(vertex1);
+        int index2 = indexOf(vertex2);
+
+        if (index1 == -1 || index2 == -1)
            return false;
 
-        int index1 = indexOfVertex[vertex1];
-        int index2 = indexOfVertex[vertex2];
+        return areAdjacentById(index1, index2);
+    }
 
-        return edgeExist[index1][index2] || edgeExist[index2][index1];
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief areAdjacentById checks whether vertices with given indexes are adjacent
+     * @param index1 - index of the first vertex
+     * @param index2 - index of the second vertex
+     * @return true if vertices are adjacent and false in other cases
+     */
+    bool areAdjacentById(int index1, int index2) const {
+        return hasEdge(index1, index2) || hasEdge(index2, index1);
     }
 
     /**
-     * Worst case time complexity - O(V*log(matrix.size))
+     * Worst case time complexity - O(1)
      *
-     * @brief degree returns the degree of a given vertex
-     * @param vertex - given vertex
-     * @return the degree of a given vertex
+     * @brief indexCount returns the upper bound of vertex indexes
+     * @return the upper bound of vertex indexes
      */
-    virtual int degree(const V& vertex) override {
-        if (indexOfVertex.count(vertex) == 0)
-            return -1; // such vertex does not exist in the graph
+    int indexCount() const {
+        return lastIndex;
+    }
 
-        int index = indexOfVertex[vertex];
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexExist returns true if there is a vertex with the given index
+     * @param index - index to check
+     * @return true if there is a vertex with the given index
+     */
+    bool indexExist(int index) const {
+        return vertices.indexExist(index);
+    }
 
-        int degree = 0;
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief vertexAt returns the vertex stored by the given index
+     * @param index - index of the vertex
+     * @return the vertex stored by the given index
+     */
+    const V& vertexAt(int index) const {
+        return vertices.vertexAt(index);
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief forEachNeighbor calls function(to, weight) for every outgoing edge of a vertex
+     * @param index - index of the vertex
+     * @param function - callback for every edge
+     */
+    template <typename F>
+    void forEachNeighbor(int index, F function) const {
+        for (const int& vertex : neighbors[index])
+            function(vertex, weight(index, vertex));
+    }
+
+    /**
+     * Worst case time complexity - O(degree)
+     *
+     * @brief forEachInNeighbor calls function(from, weight) for every incoming edge of a vertex
+     * @param index - index of the vertex
+     * @param function - callback for every edge
+     */
+    template <typename F>
+    void forEachInNeighbor(int index, F function) const {
+        for (const int& vertex : inNeighbors[index])
+            function(vertex, weight(vertex, index));
+    }
+
+    /**
+     * Worst case time complexity - O(V + E)
+     *
+     * @brief toCSR builds an immutable compressed sparse row snapshot of the graph,
+     *        live vertices are renumbered into 0 .. numberOfVertices - 1 keeping their order
+     * @return compressed sparse row snapshot of the graph
+     */
+    CSRGraph<V, E> toCSR() const {
+        CSRGraph<V, E> csr;
+
+        std::vector<int> newIndex(lastIndex, -1);
+
+        for (int i = 0; i < lastIndex; i++) {
+            if (!indexExist(i))
+                continue;
+
+            newIndex[i] = csr.numberOfVertices++;
+            csr.vertexByIndex.push_back(vertexAt(i));
+        }
+
+        csr.indexOfVertex.reserve(csr.numberOfVertices);
+        for (int i = 0; i < csr.numberOfVertices; i++)
+            csr.indexOfVertex.insert(csr.vertexByIndex[i], i);
+
+        csr.offsets.assign(csr.numberOfVertices + 1, 0);
 
         for (int i = 0; i < lastIndex; i++) {
-            if (!vertexExist(i))
+            if (newIndex[i] == -1)
                 continue;
 
-            if (edgeExist[index][i])
-                degree++;
+            csr.offsets[newIndex[i] + 1] = neighbors[i].size();
         }
 
-        return degree;
+        for (int i = 0; i < csr.numberOfVertices; i++)
+            csr.offsets[i + 1] += csr.offsets[i];
+
+        csr.targets.resize(csr.offsets.back());
+        csr.weights.resize(csr.offsets.back());
+
+        for (int i = 0; i < lastIndex; i++) {
+            if (newIndex[i] == -1)
+                continue;
+
+            size_t position = csr.offsets[newIndex[i]];
+
+            for (const int& vertex : neighbors[i]) {
+                csr.targets[position] = newIndex[vertex];
+                csr.weights[position] = weight(i, vertex);
+                position++;
+            }
+        }
+
+        return csr;
     }
-};
 
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief degree returns the degree (number of outgoing edges) of a given vertex
+     * @param vertex - given vertex
+     * @return the degree of a given vertex
+     */
+    virtual int degree(const V& vertex) override {
+        int index = indexOf(vertex);
+
+        if (index == -1)
+            return -1; // such vertex does not exist in the graph
+
+        return outDegree[index];
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief degreeById returns the degree (number of outgoing edges) of a vertex with the given index
+     * @param index - index of the vertex
+     * @return the degree of a vertex
+     */
+    int degreeById(int index) const {
+        return outDegree[index];
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief inDegreeOf returns the number of incoming edges of a given vertex
+     * @param vertex - given vertex
+     * @return the number of incoming edges of a given vertex
+     */
+    int inDegreeOf(const V& vertex) {
+        int index = indexOf(vertex);
+
+        if (index == -1)
+            return -1; // such vertex does not exist in the graph
 
+        return inDegree[index];
+    }
 
+    /**
+     * Worst case time complexity - O(V / 64)
+     *
+     * @brief commonNeighbors returns the number of vertices both given vertices have edges to
+     * @param vertex1 - first vertex
+     * @param vertex2 - second vertex
+     * @return the number of common outgoing neighbors, -1 if one of vertices does not exist
+     */
+    int commonNeighbors(const V& vertex1, const V& vertex2) {
+        int index1 = indexOf(vertex1);
+        int index2 = indexOf(vertex2);
 
+        if (index1 == -1 || index2 == -1)
+            return -1;
 
+        return (int)bit_row::countAnd(edgeRow(index1), edgeRow(index2), bit_row::paddedWordsFor(lastIndex));
+    }
 
+    /**
+     * Worst case time complexity - O(V^2 / 64)
+     *
+     * @brief numberOfEdges counts directed edges of the graph by popcount over all rows
+     * @return number of directed edges of the graph
+     */
+    size_t numberOfEdges() const {
+        size_t result = 0;
 
+        for (int i = 0; i < lastIndex; i++)
+            result += bit_row::count(edgeRow(i), bit_row::paddedWordsFor(lastIndex));
 
+        return result;
+    }
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief The MappedFile class maps a whole file into memory for reading (POSIX mmap)
+ *        and unmaps it when destroyed
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ */
+class MappedFile {
+private:
+    const char* data_;
+    size_t      size_;
+
+public:
+    /**
+     * Worst case time complexity - O(1), pages are loaded lazily on access
+     *
+     * @brief MappedFile maps the file with the given path
+     * @param path - path to the file
+     */
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+        int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor == -1)
+            throw std::runtime_error("Cannot open file " + path);
+
+        struct stat status;
+        if (fstat(descriptor, &status) == -1) {
+            close(descriptor);
+            throw std::runtime_error("Cannot read size of file " + path);
+        }
+
+        size_ = (size_t)status.st_size;
+
+        if (size_ != 0) {
+            void* address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if (address == MAP_FAILED) {
+                close(descriptor);
+                throw std::runtime_error("Cannot map file " + path);
+            }
+
+            data_ = static_cast<const char*>(address);
+        }
+
+        close(descriptor); // the mapping stays valid after closing the descriptor
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator = (const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    ~MappedFile() {
+        if (data_ != nullptr)
+            munmap(const_cast<char*>(data_), size_);
+    }
+
+    /**
+     * @brief adviseSequential tells the kernel that the file will be read from the beginning to the end
+     */
+    void adviseSequential() const {
+        if (data_ != nullptr)
+            madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+    }
+
+    const char* data() const { return data_; }
+    size_t      size() const { return size_; }
+};
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief The SmallVector class implements a vector that keeps up to N elements inline
+ *        and moves them to the heap only when it grows further
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @param   <T> the type of elements
+ * @param   <N> the number of elements stored without heap allocation
+ */
+template <typename T, size_t N>
+class SmallVector {
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type inlineStorage[N];
+
+    T*     data_;
+    size_t size_;
+    size_t capacity_;
+
+    T* inlineData() {
+        return reinterpret_cast<T*>(inlineStorage);
+    }
+
+    bool isInline() const {
+        return data_ == reinterpret_cast<const T*>(inlineStorage);
+    }
+
+    /**
+     * Worst case time complexity - O(size)
+     *
+     * @brief grow moves elements into a new heap buffer of the given capacity
+     * @param newCapacity - capacity of the new buffer
+     */
+    void grow(size_t newCapacity) {
+        T* newData = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+
+        for (size_t i = 0; i < size_; i++) {
+            new (newData + i) T(std::move(data_[i]));
+            data_[i].~T();
+        }
+
+        if (!isInline())
+            ::operator delete(data_);
+
+        data_     = newData;
+        capacity_ = newCapacity;
+    }
+
+    void release() {
+        clear();
+
+        if (!isInline())
+            ::operator delete(data_);
+
+        data_     = inlineData();
+        capacity_ = N;
+    }
+
+public:
+    SmallVector() : data_(inlineData()), size_(0), capacity_(N) { }
+
+    SmallVector(const SmallVector& other) : SmallVector() {
+        reserve(other.size_);
+
+        for (size_t i = 0; i < other.size_; i++)
+            push_back(other.data_[i]);
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector() {
+        *this = std::move(other);
+    }
+
+    SmallVector& operator = (const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+
+            for (size_t i = 0; i < other.size_; i++)
+                push_back(other.data_[i]);
+        }
+
+        return *this;
+    }
+
+    SmallVector& operator = (SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this == &other)
+            return *this;
+
+        release();
+
+        if (other.isInline()) {
+            for (size_t i = 0; i < other.size_; i++)
+                push_back(std::move(other.data_[i]));
+
+            other.clear();
+        } else {
+            data_     = other.data_;
+            size_     = other.size_;
+            capacity_ = other.capacity_;
+
+            other.data_     = other.inlineData();
+            other.size_     = 0;
+            other.capacity_ = N;
+        }
+
+        return *this;
+    }
+
+    ~SmallVector() {
+        release();
+    }
+
+    /**
+     * Amortized time complexity - O(1)
+     *
+     * @brief push_back appends an element to the end of the vector, the element may belong to the vector itself
+     * @param value - element to append
+     */
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            T copy(value); // growing destroys the value if it is an element of the vector
+
+            grow(capacity_ * 2);
+            new (data_ + size_) T(std::move(copy));
+        } else {
+            new (data_ + size_) T(value);
+        }
+
+        size_++;
+    }
+
+    /**
+     * Amortized time complexity - O(1)
+     *
+     * @brief push_back appends an element to the end of the vector, the element may belong to the vector itself
+     * @param value - element to append
+     */
+    void push_back(T&& value) {
+        if (size_ == capacity_) {
+            T moved(std::move(value)); // growing destroys the value if it is an element of the vector
+
+            grow(capacity_ * 2);
+            new (data_ + size_) T(std::move(moved));
+        } else {
+            new (data_ + size_) T(std::move(value));
+        }
+
+        size_++;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief pop_back removes the last element of the vector
+     */
+    void pop_back() {
+        data_[--size_].~T();
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief swapRemove removes the element by the given position moving the last one in its place
+     * @param position - position of the element to remove
+     */
+    void swapRemove(size_t position) {
+        if (position != size_ - 1)
+            data_[position] = std::move(data_[size_ - 1]);
+
+        pop_back();
+    }
+
+    /**
+     * Worst case time complexity - O(size)
+     *
+     * @brief reserve makes room for at least the given number of elements
+     * @param newCapacity - number of elements to make room for
+     */
+    void reserve(size_t newCapacity) {
+        if (newCapacity > capacity_)
+            grow(newCapacity);
+    }
+
+    /**
+     * Worst case time complexity - O(size)
+     *
+     * @brief clear destroys all the elements keeping the capacity
+     */
+    void clear() {
+        for (size_t i = 0; i < size_; i++)
+            data_[i].~T();
+
+        size_ = 0;
+    }
+
+    size_t size()     const { return size_; }
+    size_t capacity() const { return capacity_; }
+    bool   empty()    const { return size_ == 0; }
+
+    T&       operator [] (size_t position)       { return data_[position]; }
+    const T& operator [] (size_t position) const { return data_[position]; }
+
+    T*       begin()       { return data_; }
+    const T* begin() const { return data_; }
+    T*       end()         { return data_ + size_; }
+    const T* end()   const { return data_ + size_; }
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+
+#include "graph/flat_hash_map.h"
+
+/**
+ * @brief The VertexInterner class maps vertices to dense integer indexes and back,
+ *        vertex -> index goes through a FlatHashMap, index -> vertex is a plain vector lookup
+ *
+ * @author  Evgeny Gerasimov
+ * @version 1.0; 18.10.2026
+ * @see     FlatHashMap
+ * @param   <V> the type of vertices
+ */
+template <typename V>
+class VertexInterner {
+private:
+    FlatHashMap<V, int>    indexOfVertex;
+    std::pmr::vector<V>    vertexByIndex;
+    std::pmr::vector<bool> isLive;
+
+public:
+    explicit VertexInterner(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : indexOfVertex(resource), vertexByIndex(resource), isLive(resource) { }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief indexOf returns index of the vertex, -1 if there is no such vertex
+     * @param vertex - given vertex
+     * @return index of the vertex, -1 if there is no such vertex
+     */
+    int indexOf(const V& vertex) const {
+        const int* index = indexOfVertex.find(vertex);
+
+        return index == nullptr ? -1 : *index;
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief contains returns true if the vertex is bound to some index
+     * @param vertex - given vertex
+     * @return true if the vertex is bound to some index
+     */
+    bool contains(const V& vertex) const {
+        return indexOfVertex.count(vertex) == 1;
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief indexExist returns true if some vertex is bound to the index
+     * @param index - given index
+     * @return true if some vertex is bound to the index
+     */
+    bool indexExist(int index) const {
+        return index >= 0 && (size_t)index < isLive.size() && isLive[index];
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief vertexAt returns the vertex bound to the index
+     * @param index - given index
+     * @return the vertex bound to the index
+     */
+    const V& vertexAt(int index) const {
+        return vertexByIndex[index];
+    }
+
+    /**
+     * Amortized expected time complexity - O(1)
+     *
+     * @brief bind binds the vertex to the index
+     * @param vertex - given vertex
+     * @param index - given index
+     */
+    void bind(const V& vertex, int index) {
+        if ((size_t)index >= vertexByIndex.size()) {
+            vertexByIndex.resize(index + 1);
+            isLive.resize(index + 1, false);
+        }
+
+        vertexByIndex[index] = vertex;
+        isLive[index] = true;
+
+        indexOfVertex.insert(vertex, index);
+    }
+
+    /**
+     * Expected time complexity - O(1)
+     *
+     * @brief unbind releases the index and the vertex bound to it
+     * @param index - given index
+     */
+    void unbind(int index) {
+        if (!indexExist(index))
+            return;
+
+        indexOfVertex.erase(vertexByIndex[index]);
+
+        vertexByIndex[index] = V();
+        isLive[index] = false;
+    }
+
+    /**
+     * Worst case time complexity - O(n)
+     *
+     * @brief reserve makes room for the given number of vertices
+     * @param vertices - number of vertices
+     */
+    void reserve(size_t vertices) {
+        indexOfVertex.reserve(vertices);
+        vertexByIndex.reserve(vertices);
+        isLive.reserve(vertices);
+    }
+
+    /**
+     * Worst case time complexity - O(1)
+     *
+     * @brief size returns number of bound vertices
+     * @return number of bound vertices
+     */
+    size_t size() const {
+        return indexOfVertex.size();
+    }
+};
@@ -0,0 +1,791 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <string>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <climits>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "btree/btree.h"
+#include "fibonacci_heap/fibonacci_heap.h"
+#include "fibonacci_heap/fibonacci_heap_node.h"
+#include "graph/graph_on_adjacency_matrix.h"
+#include "algorithms/merge_sort.h"
+
+/**
+ * Randomized differential stress test: BTree, FibonacciHeap, AdjacencyMatrix and mergeSort run long seeded sequences
+ * of random operations, and after every operation the result is compared with a reference model on the standard
+ * library (std::multimap, std::set, std::map and std::stable_sort). The internal structure of FibonacciHeap
+ * and of AdjacencyMatrix is validated as a whole every few hundred operations.
+ *
+ * Every operation on a tested structure is timed separately. The latencies are printed as CSV:
+ *     structure,operation,count,p50_ns,p90_ns,p99_ns,p999_ns,max_ns
+ * A previous output passed as --baseline fails the run when a p99 grows more than --threshold times
+ * (and by more than --slack nanoseconds, which hides the timer noise of the fastest operations).
+ * Baselines are comparable only between runs with the same --seed, --operations and --rounds.
+ *
+ * Usage: stress [--seed S] [--operations N] [--rounds R] [--seconds T] [--filter TEXT]
+ *               [--baseline FILE] [--threshold X] [--slack NS]
+ * round r uses seed S + r, so a failure is reproduced by --seed <seed of the round> --rounds 1 --filter <structure>,
+ * --seconds T repeats rounds until T seconds have passed.
+ * Exit code: 0 - passed, 1 - results differ from the model, 2 - bad options, 3 - p99 regressed.
+ */
+namespace {
+
+    struct Options {
+        uint64_t    seed       = 1;
+        size_t      operations = 100000;
+        int         rounds     = 1;
+        double      seconds    = 0;
+        std::string filter;
+        std::string baseline;
+        double      threshold  = 1.5;
+        double      slack      = 200;
+    };
+
+    Options options;
+
+    typedef std::chrono::steady_clock Clock;
+
+    const size_t MAX_REPORTED_MISMATCHES = 20;
+    const size_t VALIDATE_EVERY          = 500; // operations between full validations of a structure
+    const size_t MIN_GATED_SAMPLES       = 1000; // p99 of rarer operations is too noisy to gate on
+
+    size_t mismatches = 0;
+
+    std::map<std::string, std::vector<uint32_t>> latencies; // "structure,operation" -> nanoseconds of every call
+
+    std::vector<uint32_t>& series(const std::string& structure, const std::string& operation) {
+        return latencies[structure + "," + operation];
+    }
+
+    /**
+     * @brief timed calls operation() and appends its duration in nanoseconds to the series
+     * @return the result of operation()
+     */
+    template <typename F>
+    auto timed(std::vector<uint32_t>& series, F operation) {
+        Clock::time_point start = Clock::now();
+
+        if constexpr (std::is_void<decltype(operation())>::value) {
+            operation();
+            series.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        } else {
+            auto result = operation();
+            series.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+
+            return result;
+        }
+    }
+
+    bool isSelected(const std::string& structure) {
+        return options.filter.empty() || structure.find(options.filter) != std::string::npos;
+    }
+
+    /**
+     * @brief The Round struct identifies the operation being checked, so that a mismatch can be reproduced
+     */
+    struct Round {
+        const char* structure;
+        uint64_t    seed;
+        size_t      operation;
+
+        /**
+         * @brief expect reports a mismatch with the model, the round of the structure stops at the first one
+         *        because the structure and the model have diverged
+         * @return the condition
+         */
+        bool expect(bool condition, const std::string& description) {
+            if (!condition) {
+                if (mismatches < MAX_REPORTED_MISMATCHES)
+                    std::cerr << "MISMATCH " << structure << " seed " << seed << " operation " << operation << ": "
+                              << description << std::endl;
+                mismatches++;
+            }
+
+            return condition;
+        }
+    };
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    void stressBTree(uint64_t seed) {
+        std::mt19937_64 random(seed);
+
+        Round round = { "BTree", seed, 0 };
+
+        std::vector<uint32_t>& add         = series(round.structure, "add");
+        std::vector<uint32_t>& lookup      = series(round.structure, "lookup");
+        std::vector<uint32_t>& contains    = series(round.structure, "contains");
+        std::vector<uint32_t>& lookupRange = series(round.structure, "lookupRange");
+
+        int keyRange = (int)std::max<size_t>(16, options.operations / 4); // small enough for duplicate keys
+
+        BTree<int, int*> tree(2 + (int)(random() % 15));
+
+        std::multimap<int, int*> model;
+        std::deque<int>          values; // value of a key points to a copy of the key, addresses are stable
+
+        for (; round.operation < options.operations; round.operation++) {
+            int kind = (int)(random() % 100);
+            int key  = (int)(random() % keyRange);
+
+            if (kind < 40) {
+                values.push_back(key);
+                int* value = &values.back();
+
+                timed(add, [&]() { tree.add(key, value); });
+                model.insert({ key, value });
+            } else if (kind < 70) {
+                int* value = timed(lookup, [&]() { return tree.lookup(key); });
+
+                bool found = model.count(key) != 0;
+                if (!round.expect(found ? value != nullptr && *value == key : value == nullptr,
+                                  "lookup(" + std::to_string(key) + ")"))
+                    return;
+            } else if (kind < 85) {
+                bool found = timed(contains, [&]() { return tree.contains(key); });
+
+                if (!round.expect(found == (model.count(key) != 0), "contains(" + std::to_string(key) + ")"))
+                    return;
+            } else {
+                int to = key + (int)(random() % 64);
+
+                std::vector<int*> range = timed(lookupRange, [&]() { return tree.lookupRange(key, to); });
+
+                std::vector<int*> expected;
+                for (auto it = model.lower_bound(key); it != model.end() && it->first <= to; ++it)
+                    expected.push_back(it->second);
+
+                std::sort(range.begin(), range.end());
+                std::sort(expected.begin(), expected.end());
+
+                if (!round.expect(range == expected, "lookupRange(" + std::to_string(key) + ", " + std::to_string(to) +
+                                  ") returns " + std::to_string(range.size()) + " values instead of " +
+                                  std::to_string(expected.size())))
+                    return;
+            }
+
+            if (!round.expect(tree.size() == (int)model.size() && tree.isEmpty() == model.empty(),
+                              "size() is " + std::to_string(tree.size()) + " instead of " + std::to_string(model.size())))
+                return;
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    typedef Node<long long, size_t> HeapNode; // value - position of the node in the vector of live nodes
+
+    /**
+     * @brief validateTree checks the links, the heap order and the degree of every node of the tree of the root,
+     *        and that a node of degree k has at least F(k + 2) nodes in its tree (this needs cascading cuts)
+     * @param limit - number of nodes in the heap, longer lists of children are broken
+     * @param nodes - number of nodes in the tree for the result
+     * @return description of the first violation, empty if there is none
+     */
+    std::string validateTree(HeapNode* root, size_t limit, size_t& nodes) {
+        static const std::vector<size_t> FIBONACCI = []() {
+            std::vector<size_t> numbers = { 0, 1 };
+            while (numbers.size() < 94)
+                numbers.push_back(numbers[numbers.size() - 1] + numbers[numbers.size() - 2]);
+            return numbers;
+        }();
+
+        size_t size = 1;
+
+        if (root->child != nullptr) {
+            HeapNode* child  = root->child;
+            size_t    degree = 0;
+
+            do {
+                if (child->parent != root || child->right->left != child || child->left->right != child)
+                    return "broken links of a child";
+                if (child->key < root->key)
+                    return "a child has a smaller key than its parent";
+
+                size_t childSize = 0;
+
+                std::string violation = validateTree(child, limit, childSize);
+                if (!violation.empty())
+                    return violation;
+
+                size += childSize;
+                degree++;
+                child = child->right;
+            } while (child != root->child && degree <= limit);
+
+            if (degree != (size_t)root->degree)
+                return "degree " + std::to_string(root->degree) + " of a node with " + std::to_string(degree) + " children";
+        } else if (root->degree != 0) {
+            return "degree " + std::to_string(root->degree) + " of a node without children";
+        }
+
+        if (root->degree + 2 < (int)FIBONACCI.size() && size < FIBONACCI[root->degree + 2])
+            return "a node of degree " + std::to_string(root->degree) + " has only " + std::to_string(size) +
+                   " nodes in its tree";
+
+        nodes = size;
+        return "";
+    }
+
+    std::string validateHeap(FibonacciHeap<long long, size_t>& heap) {
+        HeapNode* minimum = heap.findMin();
+
+        if (minimum == nullptr)
+            return heap.size() == 0 ? "" : "no minimum in a non-empty heap";
+
+        size_t    nodes = 0;
+        HeapNode* root  = minimum;
+
+        do {
+            if (root->parent != nullptr || root->right->left != root || root->left->right != root)
+                return "broken links of a root";
+            if (root->key < minimum->key)
+                return "a root has a smaller key than the minimum";
+
+            size_t treeSize = 0;
+
+            std::string violation = validateTree(root, heap.size(), treeSize);
+            if (!violation.empty())
+                return violation;
+
+            nodes += treeSize;
+            root   = root->right;
+        } while (root != minimum && nodes <= heap.size());
+
+        if (nodes != heap.size())
+            return std::to_string(nodes) + " nodes in the trees of a heap of size " + std::to_string(heap.size());
+
+        return "";
+    }
+
+    void stressFibonacciHeap(uint64_t seed) {
+        std::mt19937_64 random(seed);
+
+        Round round = { "FibonacciHeap", seed, 0 };
+
+        std::vector<uint32_t>& insert      = series(round.structure, "insert");
+        std::vector<uint32_t>& findMin     = series(round.structure, "findMin");
+        std::vector<uint32_t>& extractMin  = series(round.structure, "extractMin");
+        std::vector<uint32_t>& decreaseKey = series(round.structure, "decreaseKey");
+        std::vector<uint32_t>& deleteItem  = series(round.structure, "deleteItem");
+        std::vector<uint32_t>& unionWith   = series(round.structure, "unionWith");
+
+        const long long KEY_RANGE = 1LL << 40;
+
+        FibonacciHeap<long long, size_t> heap(LLONG_MIN);
+
+        std::set<std::pair<long long, HeapNode*>> model;
+        std::vector<std::unique_ptr<HeapNode>>    nodes; // all the nodes ever inserted
+        std::vector<HeapNode*>                    live;  // nodes in the heap
+
+        auto newNode = [&](long long key) {
+            nodes.push_back(std::make_unique<HeapNode>(key, live.size()));
+            live.push_back(nodes.back().get());
+            model.insert({ key, nodes.back().get() });
+
+            return nodes.back().get();
+        };
+
+        auto forget = [&](HeapNode* node) {
+            model.erase({ node->key, node });
+
+            live[node->value]        = live.back();
+            live[node->value]->value = node->value;
+            live.pop_back();
+        };
+
+        for (; round.operation < options.operations; round.operation++) {
+            int kind = (int)(random() % 100);
+
+            if (kind < 35 || live.empty()) {
+                HeapNode* node = newNode((long long)(random() % KEY_RANGE));
+
+                timed(insert, [&]() { heap.insert(node); });
+            } else if (kind < 45) {
+                HeapNode* node = timed(findMin, [&]() { return heap.findMin(); });
+
+                if (!round.expect(node != nullptr && node->key == model.begin()->first, "findMin()"))
+                    break;
+            } else if (kind < 65) {
+                HeapNode* node = timed(extractMin, [&]() { return heap.extractMin(); });
+
+                if (!round.expect(node->key == model.begin()->first, "extractMin() returns a node with key " +
+                                  std::to_string(node->key) + " instead of " + std::to_string(model.begin()->first)))
+                    break;
+
+                forget(node);
+            } else if (kind < 85) {
+                // small decreases keep the node under its parent, large ones cut it and cascade
+                HeapNode* node = live[random() % live.size()];
+                long long key  = node->key - (long long)(random() % (random() % 2 == 0 ? 16 : KEY_RANGE));
+
+                model.erase({ node->key, node });
+                model.insert({ key, node });
+
+                timed(decreaseKey, [&]() { heap.decreaseKey(node, key); });
+            } else if (kind < 95) {
+                HeapNode* node = live[random() % live.size()];
+
+                forget(node);
+
+                timed(deleteItem, [&]() { heap.deleteItem(node); });
+            } else {
+                FibonacciHeap<long long, size_t> another(LLONG_MIN);
+
+                for (int i = (int)(random() % 8); i > 0; i--)
+                    another.insert(newNode((long long)(random() % KEY_RANGE) - KEY_RANGE / 2));
+
+                timed(unionWith, [&]() { heap.unionWith(another); });
+
+                if (!round.expect(another.isEmpty(), "unionWith() leaves nodes in the other heap"))
+                    break;
+            }
+
+            if (!round.expect(heap.size() == model.size() &&
+                              (model.empty() ? heap.findMin() == nullptr : heap.findMin()->key == model.begin()->first),
+                              "size() and findMin()"))
+                break;
+
+            if (round.operation % VALIDATE_EVERY == 0) {
+                std::string violation = validateHeap(heap);
+
+                if (!round.expect(violation.empty(), violation))
+                    break;
+            }
+        }
+
+        heap.clear(); // the destructor would extract all the nodes one by one, and they may be broken after a mismatch
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief The DirectedGraphModel struct is a reference directed graph with weighted edges and self loops
+     */
+    struct DirectedGraphModel {
+        std::set<int>                      vertices;
+        std::map<std::pair<int, int>, int> edges; // (from, to) -> weight
+
+        void insertEdge(int from, int to, int weight) {
+            if (vertices.count(from) != 0 && vertices.count(to) != 0)
+                edges[{ from, to }] = weight;
+        }
+
+        void removeVertex(int vertex) {
+            vertices.erase(vertex);
+
+            for (auto it = edges.begin(); it != edges.end(); )
+                it = it->first.first == vertex || it->first.second == vertex ? edges.erase(it) : std::next(it);
+        }
+
+        std::set<std::pair<int, int>> neighbors(int vertex, bool incoming) const {
+            std::set<std::pair<int, int>> result; // (neighbor, weight)
+
+            for (const auto& edge : edges) {
+                if (!incoming && edge.first.first == vertex)
+                    result.insert({ edge.first.second, edge.second });
+                if (incoming && edge.first.second == vertex)
+                    result.insert({ edge.first.first, edge.second });
+            }
+
+            return result;
+        }
+    };
+
+    std::string validateGraph(AdjacencyMatrix<int, int>& graph, const DirectedGraphModel& model) {
+        if (graph.numberOfVertices != (int)model.vertices.size())
+            return "numberOfVertices is " + std::to_string(graph.numberOfVertices);
+        if (graph.numberOfEdges() != model.edges.size())
+            return "numberOfEdges() is " + std::to_string(graph.numberOfEdges());
+
+        for (int vertex : model.vertices) {
+            int index = graph.indexOf(vertex);
+
+            if (index == -1 || graph.vertexAt(index) != vertex)
+                return "index of vertex " + std::to_string(vertex);
+
+            for (bool incoming : { false, true }) {
+                std::set<std::pair<int, int>> neighbors;
+                auto collect = [&](int neighbor, const int& weight) { neighbors.insert({ graph.vertexAt(neighbor), weight }); };
+
+                if (incoming)
+                    graph.forEachInNeighbor(index, collect);
+                else
+                    graph.forEachNeighbor(index, collect);
+
+                if (neighbors != model.neighbors(vertex, incoming))
+                    return std::string(incoming ? "incoming" : "outgoing") + " edges of vertex " + std::to_string(vertex);
+            }
+
+            if (graph.inDegreeOf(vertex) != (int)model.neighbors(vertex, true).size())
+                return "inDegreeOf(" + std::to_string(vertex) + ")";
+        }
+
+        return "";
+    }
+
+    void stressAdjacencyMatrix(uint64_t seed) {
+        std::mt19937_64 random(seed);
+
+        Round round = { "AdjacencyMatrix", seed, 0 };
+
+        std::vector<uint32_t>& insertVertex    = series(round.structure, "insertVertex");
+        std::vector<uint32_t>& insertVertices  = series(round.structure, "insertVertices");
+        std::vector<uint32_t>& removeVertex    = series(round.structure, "removeVertex");
+        std::vector<uint32_t>& insertEdge      = series(round.structure, "insertEdge");
+        std::vector<uint32_t>& insertEdges     = series(round.structure, "insertEdges");
+        std::vector<uint32_t>& removeEdge      = series(round.structure, "removeEdge");
+        std::vector<uint32_t>& areAdjacent     = series(round.structure, "areAdjacent");
+        std::vector<uint32_t>& degree          = series(round.structure, "degree");
+        std::vector<uint32_t>& forEachNeighbor = series(round.structure, "forEachNeighbor");
+        std::vector<uint32_t>& compact         = series(round.structure, "compact");
+
+        const int VERTICES = 128;
+
+        AdjacencyMatrix<int, int> graph;
+        DirectedGraphModel        model;
+
+        for (; round.operation < options.operations; round.operation++) {
+            int kind = (int)(random() % 200);
+            int from = (int)(random() % VERTICES);
+            int to   = (int)(random() % VERTICES);
+
+            if (kind < 20) {
+                timed(insertVertex, [&]() { graph.insertVertex(from); });
+                model.vertices.insert(from);
+            } else if (kind < 24) {
+                std::vector<int> vertices((size_t)(random() % 8));
+                for (int& vertex : vertices)
+                    vertex = (int)(random() % VERTICES);
+
+                timed(insertVertices, [&]() { graph.insertVertices(vertices); });
+                model.vertices.insert(vertices.begin(), vertices.end());
+            } else if (kind < 32) {
+                timed(removeVertex, [&]() { graph.removeVertex(from); });
+                model.removeVertex(from);
+            } else if (kind < 92) {
+                int weight = (int)(random() % 1000);
+
+                timed(insertEdge, [&]() { graph.insertEdge(from, to, weight); });
+                model.insertEdge(from, to, weight);
+            } else if (kind < 98) {
+                std::vector<std::tuple<int, int, int>> edges((size_t)(random() % 16));
+                for (auto& edge : edges)
+                    edge = { (int)(random() % VERTICES), (int)(random() % VERTICES), (int)(random() % 1000) };
+
+                timed(insertEdges, [&]() { graph.insertEdges(edges); });
+
+                for (const auto& edge : edges)
+                    model.insertEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+            } else if (kind < 122) {
+                timed(removeEdge, [&]() { graph.removeEdge(from, to); });
+                model.edges.erase({ from, to });
+            } else if (kind < 162) {
+                bool adjacent = timed(areAdjacent, [&]() { return graph.areAdjacent(from, to); });
+
+                bool expected = model.edges.count({ from, to }) != 0 || model.edges.count({ to, from }) != 0;
+                if (!round.expect(adjacent == expected,
+                                  "areAdjacent(" + std::to_string(from) + ", " + std::to_string(to) + ")"))
+                    return;
+            } else if (kind < 182) {
+                int result = timed(degree, [&]() { return graph.degree(from); });
+
+                int expected = model.vertices.count(from) != 0 ? (int)model.neighbors(from, false).size() : -1;
+                if (!round.expect(result == expected, "degree(" + std::to_string(from) + ") is " + std::to_string(result) +
+                                  " instead of " + std::to_string(expected)))
+                    return;
+            } else if (kind < 199) {
+                int index = graph.indexOf(from);
+                if (index == -1)
+                    continue;
+
+                long long sum = timed(forEachNeighbor, [&]() {
+                    long long weights = 0;
+                    graph.forEachNeighbor(index, [&](int, const int& weight) { weights += weight; });
+                    return weights;
+                });
+
+                long long expected = 0;
+                for (const auto& neighbor : model.neighbors(from, false))
+                    expected += neighbor.second;
+
+                if (!round.expect(sum == expected, "weights of forEachNeighbor(" + std::to_string(from) + ")"))
+                    return;
+            } else {
+                timed(compact, [&]() { graph.compact(); });
+            }
+
+            if (round.operation % VALIDATE_EVERY == 0) {
+                std::string violation = validateGraph(graph, model);
+
+                if (!round.expect(violation.empty(), violation))
+                    return;
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief randomSequence returns a vector of random length with one of the patterns that sorts treat specially:
+     *        random, few distinct values, sorted, reversed, nearly sorted, equal, organ pipe
+     */
+    std::vector<int> randomSequence(std::mt19937_64& random) {
+        size_t n = random() % 8 == 0 ? (size_t)(random() % 4096) : (size_t)(random() % 64);
+
+        std::vector<int> sequence(n);
+
+        int pattern = (int)(random() % 7);
+        int range   = pattern == 1 ? 4 : INT_MAX;
+
+        for (size_t i = 0; i < n; i++)
+            sequence[i] = (int)(random() % range) - range / 2;
+
+        if (pattern == 2 || pattern == 4)
+            std::sort(sequence.begin(), sequence.end());
+        if (pattern == 3)
+            std::sort(sequence.begin(), sequence.end(), std::greater<int>());
+        if (pattern == 4)
+            for (size_t i = 0; n > 1 && i < n / 32 + 1; i++)
+                std::swap(sequence[random() % n], sequence[random() % n]);
+        if (pattern == 5)
+            std::fill(sequence.begin(), sequence.end(), (int)random());
+        if (pattern == 6)
+            for (size_t i = 0; i < n; i++)
+                sequence[i] = (int)std::min(i, n - i);
+
+        return sequence;
+    }
+
+    void stressMergeSort(uint64_t seed) {
+        std::mt19937_64 random(seed);
+
+        Round round = { "mergeSort", seed, 0 };
+
+        std::vector<uint32_t>& sortInts    = series(round.structure, "int");
+        std::vector<uint32_t>& sortDoubles = series(round.structure, "double");
+        std::vector<uint32_t>& sortRadix   = series(round.structure, "int RadixSort");
+        std::vector<uint32_t>& sortRange   = series(round.structure, "range projection");
+
+        for (; round.operation < options.operations; round.operation++) {
+            std::vector<int> sequence = randomSequence(random);
+
+            int kind = (int)(random() % 4);
+
+            if (kind == 0 || kind == 1) {
+                std::vector<int> expected = sequence;
+                std::stable_sort(expected.begin(), expected.end());
+
+                if (kind == 0)
+                    timed(sortInts, [&]() { mergeSort(sequence); });
+                else
+                    timed(sortRadix, [&]() { mergeSort(sequence, SortEngine::RadixSort); });
+
+                if (!round.expect(sequence == expected, "sorting " + std::to_string(sequence.size()) + " ints"))
+                    return;
+            } else if (kind == 2) {
+                std::vector<double> values(sequence.size());
+                for (size_t i = 0; i < values.size(); i++)
+                    values[i] = sequence[i] / 1024.0;
+
+                std::vector<double> expected = values;
+                std::stable_sort(expected.begin(), expected.end());
+
+                timed(sortDoubles, [&]() { mergeSort(values); });
+
+                if (!round.expect(values == expected, "sorting " + std::to_string(values.size()) + " doubles"))
+                    return;
+            } else {
+                // equal keys keep the order of their positions only if the sort is stable
+                std::vector<std::pair<int, size_t>> pairs(sequence.size());
+                for (size_t i = 0; i < pairs.size(); i++)
+                    pairs[i] = { sequence[i], i };
+
+                std::vector<std::pair<int, size_t>> expected = pairs;
+                std::stable_sort(expected.begin(), expected.end(),
+                                 [](const std::pair<int, size_t>& a, const std::pair<int, size_t>& b) { return a.first < b.first; });
+
+                timed(sortRange, [&]() { mergeSort(pairs.begin(), pairs.end(), std::less<>(), &std::pair<int, size_t>::first); });
+
+                if (!round.expect(pairs == expected, "stable sorting " + std::to_string(pairs.size()) + " pairs by a projection"))
+                    return;
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    struct Percentiles {
+        size_t   count;
+        uint32_t p50, p90, p99, p999, max;
+    };
+
+    Percentiles percentilesOf(std::vector<uint32_t> samples) {
+        std::sort(samples.begin(), samples.end());
+
+        auto at = [&](double fraction) { return samples[std::min(samples.size() - 1, (size_t)(fraction * samples.size()))]; };
+
+        return { samples.size(), at(0.5), at(0.9), at(0.99), at(0.999), samples.back() };
+    }
+
+    /**
+     * @brief readBaseline reads p99 of every "structure,operation" from a previous output
+     */
+    std::map<std::string, double> readBaseline(const std::string& path) {
+        std::ifstream input(path);
+
+        if (!input)
+            throw std::runtime_error("Cannot open baseline " + path);
+
+        std::map<std::string, double> p99;
+        std::string                   line;
+
+        while (std::getline(input, line)) {
+            if (line.empty() || line[0] == '#' || line.rfind("structure,", 0) == 0)
+                continue;
+
+            std::vector<std::string> fields;
+            std::stringstream        stream(line);
+
+            for (std::string field; std::getline(stream, field, ','); )
+                fields.push_back(field);
+
+            if (fields.size() == 8)
+                p99[fields[0] + "," + fields[1]] = std::stod(fields[5]);
+        }
+
+        return p99;
+    }
+
+    /**
+     * @brief gateRegressions compares p99 of every operation with the baseline
+     * @return number of operations whose p99 regressed
+     */
+    size_t gateRegressions(const std::map<std::string, Percentiles>& report) {
+        std::map<std::string, double> baseline = readBaseline(options.baseline);
+
+        size_t regressions = 0;
+
+        for (const auto& row : report) {
+            auto previous = baseline.find(row.first);
+
+            if (previous == baseline.end() || row.second.count < MIN_GATED_SAMPLES)
+                continue;
+
+            double limit = std::max(previous->second * options.threshold, previous->second + options.slack);
+
+            if (row.second.p99 > limit) {
+                std::cerr << "REGRESSION " << row.first << ": p99 " << row.second.p99 << " ns, baseline "
+                          << previous->second << " ns, limit " << limit << " ns" << std::endl;
+                regressions++;
+            }
+        }
+
+        return regressions;
+    }
+
+    bool parseOptions(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+
+            if (i + 1 >= argc)
+                return false;
+
+            std::string value = argv[++i];
+
+            if (option == "--seed")
+                options.seed = std::stoull(value);
+            else if (option == "--operations")
+                options.operations = std::stoull(value);
+            else if (option == "--rounds")
+                options.rounds = std::max(1, std::stoi(value));
+            else if (option == "--seconds")
+                options.seconds = std::stod(value);
+            else if (option == "--filter")
+                options.filter = value;
+            else if (option == "--baseline")
+                options.baseline = value;
+            else if (option == "--threshold")
+                options.threshold = std::stod(value);
+            else if (option == "--slack")
+                options.slack = std::stod(value);
+            else
+                return false;
+        }
+
+        return options.threshold >= 1;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    if (!parseOptions(argc, argv)) {
+        std::cerr << "usage: " << argv[0] << " [--seed S] [--operations N] [--rounds R] [--seconds T] [--filter TEXT]"
+                                             " [--baseline FILE] [--threshold X] [--slack NS]" << std::endl;
+        return 2;
+    }
+
+    const std::vector<std::pair<std::string, std::function<void(uint64_t)>>> structures = {
+        { "BTree",           stressBTree },
+        { "FibonacciHeap",   stressFibonacciHeap },
+        { "AdjacencyMatrix", stressAdjacencyMatrix },
+        { "mergeSort",       stressMergeSort },
+    };
+
+    Clock::time_point start = Clock::now();
+
+    int round = 0;
+
+    for (; mismatches == 0; round++) {
+        if (options.seconds > 0 ? std::chrono::duration<double>(Clock::now() - start).count() >= options.seconds
+                                : round >= options.rounds)
+            break;
+
+        for (const auto& structure : structures) {
+            if (!isSelected(structure.first))
+                continue;
+
+            std::cerr << structure.first << ": round " << round << ", seed " << options.seed + round << std::endl;
+
+            structure.second(options.seed + round);
+        }
+    }
+
+    std::map<std::string, Percentiles> report;
+
+    std::printf("# seed %llu, operations %zu, rounds %d\n", (unsigned long long)options.seed, options.operations, round);
+    std::printf("structure,operation,count,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+
+    for (const auto& row : latencies) {
+        if (row.second.empty())
+            continue;
+
+        Percentiles percentiles = report[row.first] = percentilesOf(row.second);
+
+        std::printf("%s,%zu,%u,%u,%u,%u,%u\n", row.first.c_str(), percentiles.count, percentiles.p50, percentiles.p90,
+                    percentiles.p99, percentiles.p999, percentiles.max);
+    }
+
+    if (mismatches != 0) {
+        std::cerr << mismatches << " mismatches with the reference models" << std::endl;
+        return 1;
+    }
+
+    if (!options.baseline.empty() && gateRegressions(report) != 0)
+        return 3;
+
+    return 0;
+}